@@ -4,6 +4,8 @@
 #include "Rivet/Projections/FastJets.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "Rivet/Tools/AliceCommon.hh"
+#include "../Jets/PerpendicularConeUE.hh"
+#include "../Jets/GroomedJets.hh"
 #include <stdio.h>
 
 namespace Rivet {
@@ -59,47 +61,21 @@ namespace Rivet {
 				prof1D->fill(jet.pT()/GeV, r80);
 			}
 
-			double GetRho(Particles eventParticles, double jetR, Jet leadingJet)
+			void FillGroomed(const GroomedJets& groomed, size_t ijet, double R0)
 			{
-				double UEphiPlus = mapAngle0To2Pi(leadingJet.phi() + M_PI/2.);
-				double UEphiMinus = mapAngle0To2Pi(leadingJet.phi() - M_PI/2.);
-				double UEeta = leadingJet.eta();
-
-				double rho = 0.;
-
-				for(const Particle& p : eventParticles)
+				_c["sowGroomedR04"]->fill();
+				for(const SoftDropSetting& sd : _softDrop)
 				{
-					double DeltaRPlus = deltaR(p.eta(), p.phi(), UEeta, UEphiPlus);
-					double DeltaRMinus = deltaR(p.eta(), p.phi(), UEeta, UEphiMinus);
-					if(DeltaRPlus > jetR && DeltaRMinus > jetR) continue;
-
-					rho += p.pT()/GeV;
+					const GroomedJets::SoftDropResult res = groomed.softDrop(ijet, sd.zcut, sd.beta, R0);
+					if(!res.passed) continue;
+					_h["SoftDrop_zg_R04_" + sd.label]->fill(res.zg);
+					_h["SoftDrop_Rg_R04_" + sd.label]->fill(res.Rg);
 				}
-
-				//Dividing by 2 because two cones were used and by cone area piR^2
-				//pT-density
-				rho /= 2.*M_PI*jetR*jetR;
-
-				return rho;
-			}
-
-                        void FillUEDist(Particles eventParticles, double jetR, Jet leadingJet, Histo1DPtr HistoUEPt, Histo1DPtr HistoUEZ, Histo1DPtr HistoUEXi)
-			{
-				double UEphiPlus = mapAngle0To2Pi(leadingJet.phi() + M_PI/2.);
-				double UEphiMinus = mapAngle0To2Pi(leadingJet.phi() - M_PI/2.);
-				double UEeta = leadingJet.eta();
-
-				for(const Particle& p : eventParticles)
+				const auto lund = groomed.splittings(ijet);
+				for(const GroomedJets::Splitting* s = lund.first; s != lund.second; s++)
 				{
-					double DeltaRPlus = deltaR(p.eta(), p.phi(), UEeta, UEphiPlus);
-					double DeltaRMinus = deltaR(p.eta(), p.phi(), UEeta, UEphiMinus);
-                                        if(DeltaRPlus > jetR && DeltaRMinus > jetR) continue;
-
-                                        HistoUEPt->fill(p.pT()/GeV);
-                                        HistoUEZ->fill(p.pT()/leadingJet.pT());
-                                        HistoUEXi->fill(log(leadingJet.pT()/p.pT()));
+					_h2["LundPlane_R04"]->fill(log(1./s->deltaR), log(s->kt/GeV));
 				}
-
 			}
 
 			double GetJetPtCorr(Jet jet, double rho)
@@ -156,6 +132,12 @@ namespace Rivet {
 				const ALICE::PrimaryParticles aprim(Cuts::abseta < 0.9 && Cuts::abscharge > 0);
 				declare(aprim, "aprim");
 
+				// Perpendicular-cone UE estimate on the same primary particles
+				declare(PerpendicularConeUE(aprim, 0.9), "PerpCones");
+
+				// R=0.4 jets from the primary particles with their C/A declustering
+				declare(GroomedJets(jetsAKTR04FJ, aprim, Cuts::pT >= 20.*GeV && Cuts::abseta < 0.5), "groomedR04");
+
 				// Create counters
 				book(_c["sow"], "sow");
 				book(_c["sow2030"], "sow2030");
@@ -166,6 +148,7 @@ namespace Rivet {
 				book(_c["sow3040UESub"], "sow3040UESub");
 				book(_c["sow4060UESub"], "sow4060UESub");
 				book(_c["sow6080UESub"], "sow6080UESub");
+				book(_c["sowGroomedR04"], "sowGroomedR04");
 
 				// Creates histograms
 				book(_h["CrossSectionAntikT_R04"], 1, 1, 1);  // Figure 2 Anti-kT
@@ -334,6 +317,14 @@ namespace Rivet {
 				book(_h["pTSpectraR04_Eta05_4060_0to6_WithoutUESub"], 72, 1, 1);
 				book(_h["pTSpectraR04_Eta05_6080_0to6_WithoutUESub"], 73, 1, 1);
 
+				// Groomed substructure of the leading R=0.4 jet, not part of the publication
+				for(const SoftDropSetting& sd : _softDrop)
+				{
+					book(_h["SoftDrop_zg_R04_" + sd.label], "SoftDrop_zg_R04_" + sd.label, 20, 0., 0.5);
+					book(_h["SoftDrop_Rg_R04_" + sd.label], "SoftDrop_Rg_R04_" + sd.label, 20, 0., 0.4);
+				}
+				book(_h2["LundPlane_R04"], "LundPlane_R04", 20, 0., 5., 20, -3., 5.);
+
 
 			}
 
@@ -346,6 +337,7 @@ namespace Rivet {
 				// Retrieve clustered jets, sorted by pT, with a minimum pT cut
 				const ALICE::PrimaryParticles aprim = apply<ALICE::PrimaryParticles>(event, "aprim");
 				const Particles ALICEparticles = aprim.particles();
+				const PerpendicularConeUE& ue = apply<PerpendicularConeUE>(event, "PerpCones");
 
 				// Anti-KT alg. - Resolution = 0.2, Eta = 0.7 (From 0.9 - 0.2)
 				FastJets jetsAKTR02FJ = apply<FastJets>(event, "jetsAKTR02FJ");
@@ -354,7 +346,7 @@ namespace Rivet {
 				double rho02 = 0.;
 
 				if(jetsAKTR02.size() != 0) {
-					rho02 = GetRho(ALICEparticles, 0.2, jetsAKTR02[0]);
+					rho02 = ue.rho(jetsAKTR02[0], 0.2);
 
 					_p["mean_ALICEvsMC_R02_Eta_07"]->fill(GetJetPtCorr(jetsAKTR02[0], rho02), jetsAKTR02[0].particles().size()); // Figure 7
 					_p["mean_ALICEvsMC_R02_Eta_07_WithoutUESub"]->fill(jetsAKTR02[0].pT()/GeV, jetsAKTR02[0].particles().size()); // Figure A.2
@@ -400,7 +392,7 @@ namespace Rivet {
 				double rho03 = 0;
 
 				if (jetsAKTR03.size() != 0) {
-					rho03 = GetRho(ALICEparticles, 0.3, jetsAKTR03[0]);
+					rho03 = ue.rho(jetsAKTR03[0], 0.3);
 				}
 
 				for(auto jet: jetsAKTR03) {
@@ -408,12 +400,13 @@ namespace Rivet {
 				}
 
 				// Anti-KT alg. - Resolution = 0.4, Eta = 0.5 (From 0.9 - 0.4)
-				FastJets jetsAKTR04FJ = apply<FastJets>(event, "jetsAKTR04FJ");
-				jetsAKTR04FJ.calc(ALICEparticles);
-				Jets jetsAKTR04 = jetsAKTR04FJ.jetsByPt(Cuts::pT >= 20.*GeV && Cuts::abseta < 0.5);
+				const GroomedJets& groomedR04 = apply<GroomedJets>(event, "groomedR04");
+				const Jets& jetsAKTR04 = groomedR04.jets();
 				double rho04 = 0;
 				if(jetsAKTR04.size() != 0) {
-					rho04 = GetRho(ALICEparticles, 0.4, jetsAKTR04[0]);
+					const PerpendicularConeUE::Cones cones04 = ue.cones(jetsAKTR04[0], 0.4);
+					rho04 = cones04.rho();
+					FillGroomed(groomedR04, 0, 0.4);
 
 					_p["mean_ALICEvsMC_R04_Eta_05"]->fill(GetJetPtCorr(jetsAKTR04[0], rho04), jetsAKTR04[0].particles().size()); // Figure 7
 					_p["mean_ALICEvsMC_R04_Eta_05_WithoutUESub"]->fill(jetsAKTR04[0].pT()/GeV, jetsAKTR04[0].particles().size()); // Figure A.2
@@ -422,7 +415,7 @@ namespace Rivet {
                                         if (inRange(GetJetPtCorr(jetsAKTR04[0], rho04), 20., 30.)) {
                                                 _c["sow2030UESub"]->fill();
 						FillRadialDistribution(_p["pTR04_Eta05_2030"], jetsAKTR04[0]); // Figure 9
-                                                FillUEDist(ALICEparticles, 0.4, jetsAKTR04[0], _h["pTSpectraR04_Eta05_2030_ALICEvsMC_UE"], _h["pTSpectraR04_Eta05_2030_0to1_UE"], _h["pTSpectraR04_Eta05_2030_0to6_UE"]);
+                                                ue.fillUE(cones04, jetsAKTR04[0], _h["pTSpectraR04_Eta05_2030_ALICEvsMC_UE"], _h["pTSpectraR04_Eta05_2030_0to1_UE"], _h["pTSpectraR04_Eta05_2030_0to6_UE"]);
 						for (auto p : jetsAKTR04[0].particles()) {
 							_h["pTSpectraR04_Eta05_2030_ALICEvsMC"]->fill(p.pT()/GeV); // Figure 12
                                                         _h["pTSpectraR04_Eta05_2030_0to1"]->fill(p.pT()/jetsAKTR04[0].pT()); // Figure 13
@@ -432,7 +425,7 @@ namespace Rivet {
                                         else if(inRange(GetJetPtCorr(jetsAKTR04[0], rho04), 30., 40.)) {
                                                 _c["sow3040UESub"]->fill();
 						FillRadialDistribution(_p["pTR04_Eta05_3040"], jetsAKTR04[0]); // Figure 9
-                                                FillUEDist(ALICEparticles, 0.4, jetsAKTR04[0], _h["pTSpectraR04_Eta05_3040_ALICEvsMC_UE"], _h["pTSpectraR04_Eta05_3040_0to1_UE"], _h["pTSpectraR04_Eta05_3040_0to6_UE"]);
+                                                ue.fillUE(cones04, jetsAKTR04[0], _h["pTSpectraR04_Eta05_3040_ALICEvsMC_UE"], _h["pTSpectraR04_Eta05_3040_0to1_UE"], _h["pTSpectraR04_Eta05_3040_0to6_UE"]);
 						for (auto p : jetsAKTR04[0].particles()) {
 							_h["pTSpectraR04_Eta05_3040_ALICEvsMC"]->fill(p.pT()/GeV); // Figure 12
                                                         _h["pTSpectraR04_Eta05_3040_0to1"]->fill(p.pT()/jetsAKTR04[0].pT()); // Figure 13
@@ -442,7 +435,7 @@ namespace Rivet {
                                         else if(inRange(GetJetPtCorr(jetsAKTR04[0], rho04), 40., 60.)) {
                                                 _c["sow4060UESub"]->fill();
 						FillRadialDistribution(_p["pTR04_Eta05_4060"], jetsAKTR04[0]); // Figure 9
-                                                FillUEDist(ALICEparticles, 0.4, jetsAKTR04[0], _h["pTSpectraR04_Eta05_4060_ALICEvsMC_UE"], _h["pTSpectraR04_Eta05_4060_0to1_UE"], _h["pTSpectraR04_Eta05_4060_0to6_UE"]);
+                                                ue.fillUE(cones04, jetsAKTR04[0], _h["pTSpectraR04_Eta05_4060_ALICEvsMC_UE"], _h["pTSpectraR04_Eta05_4060_0to1_UE"], _h["pTSpectraR04_Eta05_4060_0to6_UE"]);
 						for (auto p : jetsAKTR04[0].particles()) {
 							_h["pTSpectraR04_Eta05_4060_ALICEvsMC"]->fill(p.pT()/GeV); // Figure 12
                                                         _h["pTSpectraR04_Eta05_4060_0to1"]->fill(p.pT()/jetsAKTR04[0].pT()); // Figure 13
@@ -452,7 +445,7 @@ namespace Rivet {
                                         else if(inRange(GetJetPtCorr(jetsAKTR04[0], rho04), 60., 80.)) {
                                                 _c["sow6080UESub"]->fill();
 						FillRadialDistribution(_p["pTR04_Eta05_6080"], jetsAKTR04[0]); // Figure 9
-                                                FillUEDist(ALICEparticles, 0.4, jetsAKTR04[0], _h["pTSpectraR04_Eta05_6080_ALICEvsMC_UE"], _h["pTSpectraR04_Eta05_6080_0to1_UE"], _h["pTSpectraR04_Eta05_6080_0to6_UE"]);
+                                                ue.fillUE(cones04, jetsAKTR04[0], _h["pTSpectraR04_Eta05_6080_ALICEvsMC_UE"], _h["pTSpectraR04_Eta05_6080_0to1_UE"], _h["pTSpectraR04_Eta05_6080_0to6_UE"]);
 						for (auto p : jetsAKTR04[0].particles()) {
 							_h["pTSpectraR04_Eta05_6080_ALICEvsMC"]->fill(p.pT()/GeV); // Figure 12
                                                         _h["pTSpectraR04_Eta05_6080_0to1"]->fill(p.pT()/jetsAKTR04[0].pT()); // Figure 13
@@ -522,7 +515,7 @@ namespace Rivet {
 				double rho04KT = 0;
 
 				if (jetsKTR04.size() != 0) {
-					rho04KT = GetRho(ALICEparticles, 0.4, jetsKTR04[0]);
+					rho04KT = ue.rho(jetsKTR04[0], 0.4);
 				}
 				for(auto jet : jetsKTR04) {
 					_h["CrossSectionkT_R04"]->fill(GetJetPtCorr(jet, rho04KT)); // Figure 2
@@ -535,7 +528,7 @@ namespace Rivet {
                                 double rho04CONE = 0;
 
                                 if (jetsCONER04.size() != 0) {
-					rho04CONE = GetRho(ALICEparticles, 0.4, jetsCONER04[0]);
+					rho04CONE = ue.rho(jetsCONER04[0], 0.4);
 				}
 
 				for(auto jet : jetsCONER04){
@@ -549,7 +542,7 @@ namespace Rivet {
 				double rho06 = 0;
 
 				if(jetsAKTR06.size() != 0) {
-					rho06 = GetRho(ALICEparticles, 0.6, jetsAKTR06[0]);
+					rho06 = ue.rho(jetsAKTR06[0], 0.6);
 
 					_p["mean_ALICEvsMC_R06_Eta_03"]->fill(GetJetPtCorr(jetsAKTR06[0], rho06), jetsAKTR06[0].particles().size()); // Figure 7
 					_p["mean_ALICEvsMC_R06_Eta_03_WithoutUESub"]->fill(jetsAKTR06[0].pT()/GeV, jetsAKTR06[0].particles().size()); // Figure A.2
@@ -693,6 +686,17 @@ namespace Rivet {
 				_h["pTSpectraR04_Eta05_4060_0to6_WithoutUESub"]->scaleW(1./_c["sow4060"]->sumW());
 				_h["pTSpectraR04_Eta05_6080_0to6_WithoutUESub"]->scaleW(1./_c["sow6080"]->sumW());
 
+				// Groomed substructure per leading jet
+				if(_c["sowGroomedR04"]->sumW() > 0.)
+				{
+					for(const SoftDropSetting& sd : _softDrop)
+					{
+						_h["SoftDrop_zg_R04_" + sd.label]->scaleW(1./_c["sowGroomedR04"]->sumW());
+						_h["SoftDrop_Rg_R04_" + sd.label]->scaleW(1./_c["sowGroomedR04"]->sumW());
+					}
+					_h2["LundPlane_R04"]->scaleW(1./_c["sowGroomedR04"]->sumW());
+				}
+
 			}
 
 			///@}
@@ -704,6 +708,12 @@ namespace Rivet {
 			map<string, Profile1DPtr> _p;
 			map<string, CounterPtr> _c;
 			map<string, Scatter2DPtr> _s;
+			map<string, Histo2DPtr> _h2;
+
+			/// SoftDrop (z_cut, beta) grid evaluated on the same C/A trees
+			struct SoftDropSetting { double zcut; double beta; string label; };
+			const vector<SoftDropSetting> _softDrop = {{0.1, 0., "zcut01_beta0"}, {0.2, 0., "zcut02_beta0"},
+			                                           {0.1, 1., "zcut01_beta1"}, {0.1, 2., "zcut01_beta2"}};
 
 			fastjet::AreaDefinition *fjAreaDef02;
 			fastjet::AreaDefinition *fjAreaDef03;
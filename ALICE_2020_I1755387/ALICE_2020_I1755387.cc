@@ -5,6 +5,7 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "Rivet/Tools/AliceCommon.hh"
+#include "../Jets/GroomedJets.hh"
 
 
 namespace Rivet {
@@ -63,6 +64,23 @@ namespace Rivet {
         return rho;
     }
 
+    void FillGroomed(const GroomedJets& groomed, size_t ijet, double R0)
+    {
+        _c["sowGroomed04"]->fill();
+        for(const SoftDropSetting& sd : _softDrop)
+        {
+            const GroomedJets::SoftDropResult res = groomed.softDrop(ijet, sd.zcut, sd.beta, R0);
+            if(!res.passed) continue;
+            _h["SoftDrop_zg_R04_" + sd.label]->fill(res.zg);
+            _h["SoftDrop_Rg_R04_" + sd.label]->fill(res.Rg);
+        }
+        const auto lund = groomed.splittings(ijet);
+        for(const GroomedJets::Splitting* s = lund.first; s != lund.second; s++)
+        {
+            _h2["LundPlane_R04"]->fill(log(1./s->deltaR), log(s->kt/GeV));
+        }
+    }
+
     /// Book histograms and initialise projections before the run
     void init() {
 
@@ -99,6 +117,8 @@ namespace Rivet {
       fjAreaDef04 = new fastjet::AreaDefinition(fjGhostAreaSpec, fjAreaType);
       FastJets jet04(fs, fastjet::JetAlgorithm::antikt_algorithm, fastjet::RecombinationScheme::pt_scheme, 0.4, fjAreaDef04, JetAlg::Muons::NONE, JetAlg::Invisibles::NONE);
       declare(jet04, "jets04");
+      // R=0.4 jets from the primary particles with their C/A declustering
+      declare(GroomedJets(jet04, aprim, Cuts::pT >= 20.*GeV && Cuts::abseta < 0.3), "groomed04");
       FastJets jet05(fs, FastJets::ANTIKT, 0.5, JetAlg::Muons::NONE, JetAlg::Invisibles::NONE);
       declare(jet05, "jets05");
       FastJets jet06(fs, FastJets::ANTIKT, 0.6, JetAlg::Muons::NONE, JetAlg::Invisibles::NONE);
@@ -246,6 +266,15 @@ book(_s["RAAbias0and7R0.4"], refname33);
       book(_c["sowPBPB"], "sowPBPB");
       book(_c["ppXSec"], "ppXSec");
 
+      // Groomed substructure of the pp R=0.4 jets, not part of the publication
+      book(_c["sowGroomed04"], "sowGroomed04");
+      for(const SoftDropSetting& sd : _softDrop)
+      {
+        book(_h["SoftDrop_zg_R04_" + sd.label], "SoftDrop_zg_R04_" + sd.label, 20, 0., 0.5);
+        book(_h["SoftDrop_Rg_R04_" + sd.label], "SoftDrop_Rg_R04_" + sd.label, 20, 0., 0.4);
+      }
+      book(_h2["LundPlane_R04"], "LundPlane_R04", 20, 0., 5., 20, -3., 5.);
+
     }
 
 
@@ -274,13 +303,12 @@ book(_s["RAAbias0and7R0.4"], refname33);
 	const Particles ALICEparticles = aprim.particles();
 
         FastJets FJjets02 = apply<FastJets>(event, "jets02");
-        FastJets FJjets04 = apply<FastJets>(event, "jets04");
 
         FJjets02.calc(ALICEparticles); //give ALICE primary particles to FastJet projection
-        FJjets04.calc(ALICEparticles); //give ALICE primary particles to FastJet projection
 
         Jets jets02 = FJjets02.jetsByPt(Cuts::pT >= 20.*GeV && Cuts::abseta < 0.5); //get jets (ordered by pT)
-        Jets jets04 = FJjets04.jetsByPt(Cuts::pT >= 20.*GeV && Cuts::abseta < 0.3); //get jets (ordered by pT)
+        const GroomedJets& groomed04 = apply<GroomedJets>(event, "groomed04"); //R=0.4 jets from ALICE primary particles
+        const Jets& jets04 = groomed04.jets(); //get jets (ordered by pT)
 
 	if (CollSystem == "PBPB") {
 		const CentralityProjection& centProj = apply<CentralityProjection>(event,"V0M");
@@ -384,6 +412,11 @@ book(_s["RAAbias0and7R0.4"], refname33);
 
 	 }
 
+        for(size_t ijet = 0; ijet < jets04.size(); ijet++)
+        {
+                FillGroomed(groomed04, ijet, 0.4);
+        }
+
         for(auto jet : jets04)
         {
                 if(jet.particles(Cuts::pT > 7.*GeV).size() > 0){
@@ -447,6 +480,17 @@ book(_s["RAAbias0and7R0.4"], refname33);
         _h["ppratioR0.1divR0.6_R0.6"]->scaleW(1./0.2);
         _h["ppratioR0.2divR0.6_R0.6"]->scaleW(1./0.2);
 
+        // Groomed substructure per jet
+        if(_c["sowGroomed04"]->sumW() > 0.)
+        {
+            for(const SoftDropSetting& sd : _softDrop)
+            {
+                _h["SoftDrop_zg_R04_" + sd.label]->scaleW(1./_c["sowGroomed04"]->sumW());
+                _h["SoftDrop_Rg_R04_" + sd.label]->scaleW(1./_c["sowGroomed04"]->sumW());
+            }
+            _h2["LundPlane_R04"]->scaleW(1./_c["sowGroomed04"]->sumW());
+        }
+
 
 	divide(_h["ppratioR0.1divR0.2_R0.1"], _h["ppratioR0.1divR0.2_R0.2"], _s["ppratioR0.1divR0.2"]);
         divide(_h["ppratioR0.1divR0.3_R0.1"], _h["ppratioR0.1divR0.3_R0.3"], _s["ppratioR0.1divR0.3"]);
@@ -507,6 +551,12 @@ book(_s["RAAbias0and7R0.4"], refname33);
     map<string, Profile1DPtr> _p;
     map<string, CounterPtr> _c;
     map<string, Scatter2DPtr> _s;
+    map<string, Histo2DPtr> _h2;
+
+    /// SoftDrop (z_cut, beta) grid evaluated on the same C/A trees
+    struct SoftDropSetting { double zcut; double beta; string label; };
+    const vector<SoftDropSetting> _softDrop = {{0.1, 0., "zcut01_beta0"}, {0.2, 0., "zcut02_beta0"},
+                                               {0.1, 1., "zcut01_beta1"}, {0.1, 2., "zcut01_beta2"}};
 
     fastjet::AreaDefinition *fjAreaDef02;
     fastjet::AreaDefinition *fjAreaDef04;
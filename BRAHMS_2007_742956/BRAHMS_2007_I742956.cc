@@ -5,6 +5,7 @@
 #include "Rivet/Projections/DressedLeptons.hh"
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/PromptFinalState.hh"
+#include "../Spectra/IdentifiedParticles.hh"
 #include "math.h"
 
 namespace Rivet {
@@ -26,6 +27,9 @@ namespace Rivet {
        
         const FinalState fs(Cuts::abseta < 5);
         declare(fs, "fs");
+
+        //Identified hadrons in the two forward rapidity windows, bucketed by species
+        declare(IdentifiedParticles(fs, {211, -211, 321, -321, 2212, -2212}, Cuts::rap > 2.9 && Cuts::rap < 3.35), "id");
     
         book(_h["CrsSecPIplus"], 1, 1, 1);
         book(_h["CrsSecPIminus"], 2, 1, 1);
@@ -48,38 +52,33 @@ namespace Rivet {
     /// Perform the per-event analysis
     void analyze(const Event& event) {
 
-        Particles fsParticles = applyProjection<FinalState>(event,"fs").particles(); //At some point we will want to look at primary vs final state particles instead. The problem is BHRAMS experiment did no feed down correction.
+        const IdentifiedParticles& id = apply<IdentifiedParticles>(event,"id"); //At some point we will want to look at primary vs final state particles instead. The problem is BHRAMS experiment did no feed down correction.
+
+        double ySize = .1; //Looking at only forward Rapdities
+
+        //Histograms near y = 2.95 and y = 3.3 for every species, in the order of the codes of "id"
+        static const vector<pair<PdgId, string>> species = {{211, "CrsSecPIplus"}, {-211, "CrsSecPIminus"}, //Pion
+                                                            {321, "CrsSecKplus"}, {-321, "CrsSecKminus"}, //Kaon
+                                                            {2212, "CrsSecP"}, {-2212, "CrsSecAntiP"}}; //Proton
 
-        for(const Particle& p : fsParticles)
+        for(const auto& sp : species)
         {
+            const IdentifiedParticles::Span particles = id.particles(sp.first);
+            if(particles.empty()) continue;
 
-            double ySize = .1; //Looking at only forward Rapdities
-            
-            double pT = p.pT() / GeV;
-            
-            if((p.rapidity()>2.9)&&(p.rapidity()<3.0)){ // Interested in regions near 2.95
-                if(p.pid() == 211) _h["CrsSecPIplus"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize)); //Pion
-                if(p.pid() == -211) _h["CrsSecPIminus"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize));
-            
-                if(p.pid() == 321) _h["CrsSecKplus"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize)); //Kaon
-                if(p.pid() == -321) _h["CrsSecKminus"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize));
-            
-                if(p.pid() == 2212) _h["CrsSecP"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize)); //Pion
-                if(p.pid() == -2212) _h["CrsSecAntiP"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize));
-            }
-            if((p.rapidity()>3.25)&&(p.rapidity()<3.35)){ // Interested in regions near 3.3
-                if(p.pid() == 211) _h["CrsSecPIplus2"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize)); //Pion
-                if(p.pid() == -211) _h["CrsSecPIminus2"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize));
-            
-                if(p.pid() == 321) _h["CrsSecKplus2"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize)); //Kaon
-                if(p.pid() == -321) _h["CrsSecKminus2"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize));
-            
-                if(p.pid() == 2212) _h["CrsSecP2"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize)); //Pion
-                if(p.pid() == -2212) _h["CrsSecAntiP2"]->fill(pT,(1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize));
+            const Histo1DPtr& h = _h[sp.second];
+            const Histo1DPtr& h2 = _h[sp.second + "2"];
+
+            for(const Particle& p : particles)
+            {
+                double pT = p.pT() / GeV;
+                double w = (1.0/pT)*(1.0/(2.0*pi))*(1.0/ySize);
+
+                if((p.rapidity()>2.9)&&(p.rapidity()<3.0)) h->fill(pT, w); // Interested in regions near 2.95
+                if((p.rapidity()>3.25)&&(p.rapidity()<3.35)) h2->fill(pT, w); // Interested in regions near 3.3
             }
-        
         }
-        
+
     }
 
 
@@ -0,0 +1,263 @@
+// -*- C++ -*-
+#ifndef RIVET_CENTRALITYTABLE_HH
+#define RIVET_CENTRALITYTABLE_HH
+
+#include "Rivet/Projections/SingleValueProjection.hh"
+#include "Rivet/Projections/CentralityProjection.hh"
+#include "Rivet/Tools/RivetYODA.hh"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Rivet {
+
+/// @brief Binary estimator -> centrality percentile table.
+///
+/// Written by RHIC_2019_CentralityCalibration (option table=FILE) from the
+/// calibration distribution. The file holds the knots of the piecewise
+/// linear cumulative distribution: n ascending estimator values followed
+/// by the centrality percentile at each of them, 0% being the most central
+/// (largest estimator). Between knots the percentile is interpolated
+/// linearly, which reproduces the calibration histogram exactly.
+///
+/// Analyses map the file read-only instead of parsing a YODA calibration,
+/// and each lookup is one branchless binary search. A table can also be
+/// filled in memory with assign(), e.g. by SelfCalibratingCentrality.
+class CentralityTable {
+
+public:
+
+  static const uint32_t VERSION = 1;
+
+  /// File header, followed by n doubles of estimator values and n doubles
+  /// of percentiles.
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t n;
+    char estimator[16];
+  };
+
+  CentralityTable() { }
+
+  /// Map the table in @a path.
+  explicit CentralityTable(const std::string& path) { open(path); }
+
+  ~CentralityTable() { close(); }
+
+  CentralityTable(const CentralityTable&) = delete;
+  CentralityTable& operator=(const CentralityTable&) = delete;
+
+  void open(const std::string& path) {
+    close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0) throw UserError("CentralityTable: cannot open " + path);
+    struct stat st;
+    if(fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(Header))
+    {
+        ::close(fd);
+        throw UserError("CentralityTable: " + path + " is not a centrality table");
+    }
+    _size = st.st_size;
+    _map = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(_map == MAP_FAILED)
+    {
+        _map = nullptr;
+        throw UserError("CentralityTable: cannot map " + path);
+    }
+    const Header* h = static_cast<const Header*>(_map);
+    if(std::memcmp(h->magic, "RHICCENT", 8) != 0 || h->version != VERSION ||
+       h->n < 2 || _size != sizeof(Header) + 2*h->n*sizeof(double))
+    {
+        close();
+        throw UserError("CentralityTable: " + path + " has a wrong format or version");
+    }
+    _n = h->n;
+    _x = reinterpret_cast<const double*>(h + 1);
+    _pct = _x + _n;
+    _estimator = std::string(h->estimator, strnlen(h->estimator, sizeof(h->estimator)));
+  }
+
+  /// Use the knots @a x (ascending) and the cumulative fraction of events
+  /// @a cdf below each of them, held in memory.
+  void assign(const std::vector<double>& x, const std::vector<double>& cdf) {
+    close();
+    if(x.size() < 2 || x.size() != cdf.size()) throw UserError("CentralityTable: need at least two knots");
+    _ownX = x;
+    _ownPct.resize(cdf.size());
+    for(size_t i = 0; i < cdf.size(); i++) _ownPct[i] = 100.*(1. - cdf[i]);
+    _n = x.size();
+    _x = _ownX.data();
+    _pct = _ownPct.data();
+  }
+
+  void close() {
+    if(_map) munmap(_map, _size);
+    _map = nullptr;
+    _size = _n = 0;
+    _x = _pct = nullptr;
+    _ownX.clear();
+    _ownPct.clear();
+  }
+
+  /// Whether a table is loaded.
+  bool valid() const { return _n > 0; }
+
+  size_t size() const { return _n; }
+
+  const std::string& estimator() const { return _estimator; }
+
+  /// Estimator value at centrality percentile @a pct (inverse of percentile()).
+  double value(double pct) const {
+    if(pct >= _pct[0]) return _x[0];
+    for(size_t i = 1; i < _n; i++)
+    {
+        if(_pct[i] > pct) continue;
+        const double dp = _pct[i - 1] - _pct[i];
+        const double f = dp > 0. ? (_pct[i - 1] - pct)/dp : 0.;
+        return _x[i - 1] + f*(_x[i] - _x[i - 1]);
+    }
+    return _x[_n - 1];
+  }
+
+  /// Centrality percentile of estimator value @a v.
+  double percentile(double v) const {
+    if(v <= _x[0]) return _pct[0];
+    if(v >= _x[_n - 1]) return _pct[_n - 1];
+    // Last knot with x <= v; the loop compiles to conditional moves
+    const double* base = _x;
+    size_t len = _n;
+    while(len > 1)
+    {
+        const size_t half = len/2;
+        base = (base[half] <= v) ? base + half : base;
+        len -= half;
+    }
+    const size_t i = base - _x;
+    const double dx = _x[i + 1] - _x[i];
+    const double f = dx > 0. ? (v - _x[i])/dx : 0.;
+    return _pct[i] + f*(_pct[i + 1] - _pct[i]);
+  }
+
+  /// Write a table from the knots @a x (ascending) and the cumulative
+  /// fraction of events @a cdf below each of them.
+  static void write(const std::string& path, const std::string& estimator,
+                    const std::vector<double>& x, const std::vector<double>& cdf) {
+    Header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, "RHICCENT", 8);
+    h.version = VERSION;
+    h.n = x.size();
+    std::strncpy(h.estimator, estimator.c_str(), sizeof(h.estimator));
+    std::vector<double> pct(cdf.size());
+    for(size_t i = 0; i < cdf.size(); i++) pct[i] = 100.*(1. - cdf[i]);
+    std::ofstream out(path, std::ios::binary);
+    if(!out) throw UserError("CentralityTable: cannot write " + path);
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.write(reinterpret_cast<const char*>(x.data()), x.size()*sizeof(double));
+    out.write(reinterpret_cast<const char*>(pct.data()), pct.size()*sizeof(double));
+  }
+
+  /// Write a table from a normalised or unnormalised calibration histogram.
+  static void write(const std::string& path, const std::string& estimator, const YODA::Histo1D& h) {
+    std::vector<double> x, cdf;
+    x.reserve(h.numBins() + 1);
+    cdf.reserve(h.numBins() + 1);
+    const double total = h.sumW();
+    double sum = h.underflow().sumW();
+    x.push_back(h.xMin());
+    cdf.push_back(total > 0. ? sum/total : 0.);
+    for(const YODA::HistoBin1D& b : h.bins())
+    {
+        sum += b.sumW();
+        x.push_back(b.xMax());
+        cdf.push_back(total > 0. ? sum/total : 0.);
+    }
+    write(path, estimator, x, cdf);
+  }
+
+private:
+
+  void* _map = nullptr;
+  size_t _size = 0;
+  size_t _n = 0;
+  const double* _x = nullptr;
+  const double* _pct = nullptr;
+  std::string _estimator;
+
+  /// Storage of tables filled with assign().
+  std::vector<double> _ownX, _ownPct;
+
+};
+
+
+/// @brief Centrality percentile from an estimator and a CentralityTable.
+class CentralityTableProjection: public SingleValueProjection {
+
+public:
+
+  CentralityTableProjection(const SingleValueProjection& estimator, const std::string& path)
+    : _path(path), _table(std::make_shared<CentralityTable>(path)) {
+    setName("CentralityTableProjection");
+    declare(estimator, "Estimator");
+  }
+
+  DEFAULT_RIVET_PROJ_CLONE(CentralityTableProjection);
+
+protected:
+
+  void project(const Event& e) {
+    clear();
+    set(_table->percentile(apply<SingleValueProjection>(e, "Estimator")()));
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection& p) const {
+    const CentralityTableProjection& other = dynamic_cast<const CentralityTableProjection&>(p);
+    return mkNamedPCmp(p, "Estimator") || cmp(_path, other._path);
+  }
+
+private:
+
+  std::string _path;
+
+  /// Shared by all clones, so the file is mapped once.
+  std::shared_ptr<CentralityTable> _table;
+
+};
+
+
+/// A CentralityProjection reading the percentile from the table in
+/// @a path, to be declared in place of declareCentrality(), e.g.
+///   declare(tableCentrality(RHICCentrality("PHENIX"), path), "CMULT");
+inline CentralityProjection tableCentrality(const SingleValueProjection& estimator, const std::string& path) {
+  CentralityProjection cp;
+  cp.add(CentralityTableProjection(estimator, path), "TAB");
+  return cp;
+}
+
+}
+
+/// Declare the centrality projection PROJNAME on ESTIMATOR in an analysis'
+/// init(). With the analysis option centtable=FILE the percentiles come
+/// from that table (tableCentrality), otherwise declareCentrality() reads
+/// the CALIBRATION analysis' histogram of the same name, e.g.
+///   DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
+/// A macro rather than a function, as declare(), declareCentrality() and
+/// getOption() are members of the analysis.
+#define DECLARE_RHIC_CENTRALITY(ESTIMATOR, CALIBRATION, PROJNAME) \
+  do { \
+    const std::string centTable_ = getOption<std::string>("centtable", ""); \
+    if(!centTable_.empty()) declare(Rivet::tableCentrality(ESTIMATOR, centTable_), PROJNAME); \
+    else declareCentrality(ESTIMATOR, CALIBRATION, PROJNAME, PROJNAME); \
+  } while(0)
+
+#endif
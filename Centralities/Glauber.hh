@@ -0,0 +1,359 @@
+// -*- C++ -*-
+#ifndef RIVET_GLAUBER_HH
+#define RIVET_GLAUBER_HH
+
+#include <algorithm>
+#include <cmath>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Monte-Carlo Glauber model for <N_coll> and <N_part> per centrality class.
+///
+/// Nucleon positions are sampled from Woods-Saxon distributions (Hulthen
+/// for the deuteron), the nuclei are shifted by +-b/2 with b^2 uniform,
+/// and two nucleons collide if their transverse distance is below
+/// sqrt(sigma_NN/pi). Collisions are found with a cell list of that size,
+/// so an Au+Au event costs O(A) instead of O(A^2) distance checks.
+/// Events without a collision are discarded; centrality classes are
+/// defined by impact-parameter ordering of the remaining events.
+///
+/// The per-event (b, N_coll, N_part) arrays are cached on disk, keyed by
+/// system, cross section, number of events and seed, in the directory
+/// given by $RIVET_GLAUBER_CACHE (no disk cache if unset). Within a job
+/// Glauber::get() also keeps them in memory, so any number of analyses and
+/// binnings reuse one run.
+///
+/// The header does not depend on Rivet, so tools/glauberTables.cc can use
+/// it standalone.
+class Glauber {
+
+public:
+
+  /// Nuclear density parameters.
+  struct Nucleus {
+    std::string name;
+    int A;
+    /// Woods-Saxon radius and diffuseness in fm; for the deuteron the
+    /// Hulthen parameters a and b in 1/fm.
+    double R;
+    double a;
+    bool hulthen;
+  };
+
+  /// Known nuclei: "p", "d", "Cu", "Au", "Pb", "U" (spherical).
+  static Nucleus nucleus(const std::string& name) {
+    if(name == "p") return {"p", 1, 0., 0., false};
+    if(name == "d") return {"d", 2, 0.228, 1.18, true};
+    if(name == "Cu") return {"Cu", 63, 4.20641, 0.5977, false};
+    if(name == "Au") return {"Au", 197, 6.38, 0.535, false};
+    if(name == "Pb") return {"Pb", 208, 6.62, 0.546, false};
+    if(name == "U") return {"U", 238, 6.81, 0.60, false};
+    throw std::runtime_error("Glauber: unknown nucleus " + name);
+  }
+
+  /// Split a collision system like "AuAu", "dAu" or "CuAu" into nuclei.
+  static std::pair<std::string, std::string> splitSystem(const std::string& sys) {
+    for(size_t i = 1; i < sys.size(); i++)
+    {
+        if(std::isupper(sys[i]) || (std::islower(sys[0]) && i == 1))
+          return std::make_pair(sys.substr(0, i), sys.substr(i));
+    }
+    throw std::runtime_error("Glauber: cannot split collision system " + sys);
+  }
+
+  /// Inelastic nucleon-nucleon cross section in mb at @a sqrtsNN in GeV,
+  /// fit sigma = 28.84 + 0.0458 ln(s)^2.374 (arXiv:1710.07098).
+  static double sigmaNN(double sqrtsNN) {
+    return 28.84 + 0.0458*std::pow(std::log(sqrtsNN*sqrtsNN), 2.374);
+  }
+
+  /// Shared result for system @a sys (e.g. "AuAu") and @a sigma in mb,
+  /// run or loaded from the disk cache on first use.
+  static const Glauber& get(const std::string& sys, double sigma, size_t nEvents = 50000, unsigned seed = 1) {
+    static std::map<std::string, std::unique_ptr<Glauber>> cache;
+    const std::string k = key(sys, sigma, nEvents, seed);
+    auto it = cache.find(k);
+    if(it != cache.end()) return *it->second;
+    const std::pair<std::string, std::string> ab = splitSystem(sys);
+    std::unique_ptr<Glauber> g(new Glauber(nucleus(ab.first), nucleus(ab.second), sigma, nEvents, seed));
+    const char* dir = std::getenv("RIVET_GLAUBER_CACHE");
+    const std::string path = dir ? std::string(dir) + "/glauber_" + k + ".bin" : "";
+    if(path.empty() || !g->load(path))
+    {
+        g->run();
+        if(!path.empty()) g->save(path);
+    }
+    return *cache.emplace(k, std::move(g)).first->second;
+  }
+
+  Glauber(const Nucleus& a, const Nucleus& b, double sigma, size_t nEvents = 50000, unsigned seed = 1)
+    : _a(a), _b(b), _sigma(sigma), _nEvents(nEvents), _seed(seed) { }
+
+  /// Generate the events.
+  void run() {
+    std::mt19937_64 rng(_seed);
+    const double d2 = 0.1*_sigma/M_PI;  // mb -> fm^2
+    const double cell = std::sqrt(d2);
+    const double bMax = extent(_a) + extent(_b) + 2.*cell;
+
+    const std::vector<double> ta = radialTable(_a), tb = radialTable(_b);
+    std::vector<double> xa, ya, xb, yb;
+    std::vector<uint8_t> parta, partb;
+    std::vector<Collision> events;
+    events.reserve(_nEvents);
+    while(events.size() < _nEvents)
+    {
+        const double b = bMax*std::sqrt(uniform(rng));
+        sample(_a, ta, rng, xa, ya);
+        sample(_b, tb, rng, xb, yb);
+        for(double& x : xa) x += 0.5*b;
+        for(double& x : xb) x -= 0.5*b;
+        parta.assign(xa.size(), 0);
+        partb.assign(xb.size(), 0);
+        const int ncoll = collide(xa, ya, xb, yb, d2, cell, parta, partb);
+        if(ncoll == 0) continue;
+        int npart = 0;
+        for(uint8_t p : parta) npart += p;
+        for(uint8_t p : partb) npart += p;
+        events.push_back({float(b), uint16_t(ncoll), uint16_t(npart)});
+    }
+    std::sort(events.begin(), events.end(), [](const Collision& x, const Collision& y) { return x.b < y.b; });
+    _events.swap(events);
+  }
+
+  /// <N_coll> in centrality class [@a cmin, @a cmax) percent.
+  double ncoll(double cmin, double cmax) const { return mean(cmin, cmax, &Collision::ncoll); }
+
+  /// <N_part> in centrality class [@a cmin, @a cmax) percent.
+  double npart(double cmin, double cmax) const { return mean(cmin, cmax, &Collision::npart); }
+
+  /// <b> in fm in centrality class [@a cmin, @a cmax) percent.
+  double b(double cmin, double cmax) const {
+    const std::pair<size_t, size_t> r = range(cmin, cmax);
+    double sum = 0.;
+    for(size_t i = r.first; i < r.second; i++) sum += _events[i].b;
+    return r.second > r.first ? sum/(r.second - r.first) : 0.;
+  }
+
+  double sigma() const { return _sigma; }
+  size_t numEvents() const { return _events.size(); }
+  std::string system() const { return _a.name + _b.name; }
+
+  /// Per-event arrays in a small binary file; false if absent or different.
+  bool load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if(!in) return false;
+    char magic[8];
+    uint64_t n = 0;
+    in.read(magic, 8);
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if(!in || std::memcmp(magic, "GLAUBER1", 8) != 0 || n != _nEvents) return false;
+    std::vector<Collision> events(n);
+    in.read(reinterpret_cast<char*>(events.data()), n*sizeof(Collision));
+    if(!in) return false;
+    _events.swap(events);
+    return true;
+  }
+
+  void save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if(!out) return;
+    const uint64_t n = _events.size();
+    out.write("GLAUBER1", 8);
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char*>(_events.data()), n*sizeof(Collision));
+  }
+
+private:
+
+  struct Collision {
+    float b;
+    uint16_t ncoll;
+    uint16_t npart;
+  };
+
+  static std::string key(const std::string& sys, double sigma, size_t nEvents, unsigned seed) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s_%.2fmb_%zu_%u", sys.c_str(), sigma, nEvents, seed);
+    return buf;
+  }
+
+  /// Radius beyond which the nucleon density is negligible.
+  static double extent(const Nucleus& n) {
+    if(n.A == 1) return 0.;
+    if(n.hulthen) return 5.;
+    return n.R + 5.*n.a;
+  }
+
+  /// Uniform in [0, 1) from the top 53 bits, much cheaper than
+  /// std::uniform_real_distribution in the sampling loops.
+  static double uniform(std::mt19937_64& rng) {
+    return (rng() >> 11)*(1./9007199254740992.);
+  }
+
+  /// Inverse CDF of the radial distribution on a uniform grid in the
+  /// cumulative probability: Woods-Saxon r^2/(1 + e^{(r-R)/a}) for nuclei,
+  /// Hulthen (e^{-ar} - e^{-br})^2 for the deuteron separation. Sampling
+  /// is then one table lookup instead of rejection with exp() and cbrt().
+  static std::vector<double> radialTable(const Nucleus& n) {
+    const int nr = 8192, nq = 4096;
+    const double rMax = n.hulthen ? 20. : extent(n);
+    std::vector<double> cdf(nr + 1, 0.);
+    for(int i = 1; i <= nr; i++)
+    {
+        const double r = (i - 0.5)*rMax/nr;
+        const double p = n.hulthen ? std::pow(std::exp(-n.R*r) - std::exp(-n.a*r), 2)
+                                   : r*r/(1. + std::exp((r - n.R)/n.a));
+        cdf[i] = cdf[i - 1] + p;
+    }
+    std::vector<double> table(nq + 1);
+    table[0] = 0.;
+    table[nq] = rMax;
+    int i = 0;
+    for(int k = 1; k < nq; k++)
+    {
+        const double target = cdf[nr]*k/nq;
+        while(cdf[i + 1] < target) i++;
+        table[k] = (i + (target - cdf[i])/(cdf[i + 1] - cdf[i]))*rMax/nr;
+    }
+    return table;
+  }
+
+  /// Transverse components of r times an isotropic unit vector
+  /// (Marsaglia's method, no trigonometric functions).
+  static void transverse(double r, std::mt19937_64& rng, double& x, double& y) {
+    double u, v, s;
+    do
+    {
+        u = 2.*uniform(rng) - 1.;
+        v = 2.*uniform(rng) - 1.;
+        s = u*u + v*v;
+    }
+    while(s >= 1.);
+    const double f = 2.*r*std::sqrt(1. - s);
+    x = f*u;
+    y = f*v;
+  }
+
+  /// Sample nucleon transverse positions, centred on the nucleus.
+  static void sample(const Nucleus& n, const std::vector<double>& table, std::mt19937_64& rng,
+                     std::vector<double>& x, std::vector<double>& y) {
+    x.resize(n.A);
+    y.resize(n.A);
+    if(n.A == 1)
+    {
+        x[0] = y[0] = 0.;
+        return;
+    }
+    const double nq = table.size() - 1;
+    if(n.hulthen)
+    {
+        // Nucleons at +-half the separation
+        const double u = uniform(rng)*nq;
+        const size_t k = size_t(u);
+        transverse(0.5*(table[k] + (u - k)*(table[k + 1] - table[k])), rng, x[0], y[0]);
+        x[1] = -x[0]; y[1] = -y[0];
+        return;
+    }
+    double sx = 0., sy = 0.;
+    for(int i = 0; i < n.A; i++)
+    {
+        const double u = uniform(rng)*nq;
+        const size_t k = size_t(u);
+        transverse(table[k] + (u - k)*(table[k + 1] - table[k]), rng, x[i], y[i]);
+        sx += x[i];
+        sy += y[i];
+    }
+    sx /= n.A;
+    sy /= n.A;
+    for(int i = 0; i < n.A; i++) { x[i] -= sx; y[i] -= sy; }
+  }
+
+  /// Count the nucleon-nucleon collisions, marking the participants.
+  static int collide(const std::vector<double>& xa, const std::vector<double>& ya,
+                     const std::vector<double>& xb, const std::vector<double>& yb,
+                     double d2, double cell,
+                     std::vector<uint8_t>& parta, std::vector<uint8_t>& partb) {
+    // Cell list of nucleus B, counting sort into CSR arrays
+    double x0 = xb[0], y0 = yb[0], x1 = xb[0], y1 = yb[0];
+    for(size_t j = 1; j < xb.size(); j++)
+    {
+        x0 = std::min(x0, xb[j]); x1 = std::max(x1, xb[j]);
+        y0 = std::min(y0, yb[j]); y1 = std::max(y1, yb[j]);
+    }
+    const int nx = int((x1 - x0)/cell) + 1, ny = int((y1 - y0)/cell) + 1;
+    std::vector<int> start(nx*ny + 1, 0), cellOf(xb.size()), order(xb.size());
+    for(size_t j = 0; j < xb.size(); j++)
+    {
+        cellOf[j] = int((xb[j] - x0)/cell)*ny + int((yb[j] - y0)/cell);
+        start[cellOf[j] + 1]++;
+    }
+    for(int c = 0; c < nx*ny; c++) start[c + 1] += start[c];
+    std::vector<int> fill(start.begin(), start.end() - 1);
+    for(size_t j = 0; j < xb.size(); j++) order[fill[cellOf[j]]++] = j;
+
+    int ncoll = 0;
+    for(size_t i = 0; i < xa.size(); i++)
+    {
+        const int cx = int(std::floor((xa[i] - x0)/cell)), cy = int(std::floor((ya[i] - y0)/cell));
+        for(int ix = std::max(cx - 1, 0); ix <= std::min(cx + 1, nx - 1); ix++)
+        {
+            for(int iy = std::max(cy - 1, 0); iy <= std::min(cy + 1, ny - 1); iy++)
+            {
+                const int c = ix*ny + iy;
+                for(int k = start[c]; k < start[c + 1]; k++)
+                {
+                    const int j = order[k];
+                    const double dx = xa[i] - xb[j], dy = ya[i] - yb[j];
+                    if(dx*dx + dy*dy < d2)
+                    {
+                        ncoll++;
+                        parta[i] = 1;
+                        partb[j] = 1;
+                    }
+                }
+            }
+        }
+    }
+    return ncoll;
+  }
+
+  std::pair<size_t, size_t> range(double cmin, double cmax) const {
+    const size_t n = _events.size();
+    const size_t lo = std::min(n, size_t(std::max(cmin, 0.)/100.*n));
+    const size_t hi = std::min(n, size_t(std::max(cmax, 0.)/100.*n));
+    return std::make_pair(lo, hi);
+  }
+
+  double mean(double cmin, double cmax, uint16_t Collision::* field) const {
+    const std::pair<size_t, size_t> r = range(cmin, cmax);
+    double sum = 0.;
+    for(size_t i = r.first; i < r.second; i++) sum += _events[i].*field;
+    return r.second > r.first ? sum/(r.second - r.first) : 0.;
+  }
+
+  Nucleus _a, _b;
+  double _sigma;
+  size_t _nEvents;
+  unsigned _seed;
+
+  /// Events with at least one collision, sorted by impact parameter.
+  std::vector<Collision> _events;
+
+};
+
+}
+
+#endif
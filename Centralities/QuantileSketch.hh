@@ -0,0 +1,239 @@
+// -*- C++ -*-
+#ifndef RIVET_QUANTILESKETCH_HH
+#define RIVET_QUANTILESKETCH_HH
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Mergeable weighted quantile sketch (merging t-digest).
+///
+/// Values are kept as weighted centroids whose size is limited by the
+/// arcsine scale function, so the tails of the distribution (the most
+/// central and most peripheral classes) are resolved much better than
+/// the bulk. Sketches from independent jobs merge into a sketch of the
+/// same accuracy, independent of the order of merging, without choosing
+/// a binning in advance or keeping every value.
+///
+/// The header does not depend on Rivet so that the merge tool in tools/
+/// can use it standalone.
+class QuantileSketch {
+
+public:
+
+  /// @a compression bounds the number of centroids (about 2x).
+  explicit QuantileSketch(double compression = 200.) : _compression(compression) { }
+
+  void add(double x, double w = 1.) {
+    if(!(w > 0.)) return;
+    _buffer.push_back({x, w});
+    _min = std::min(_min, x);
+    _max = std::max(_max, x);
+    if(_buffer.size() >= size_t(5*_compression)) compress();
+  }
+
+  void merge(const QuantileSketch& other) {
+    other.compress();
+    _buffer.insert(_buffer.end(), other._centroids.begin(), other._centroids.end());
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+    compress();
+  }
+
+  double totalWeight() const { compress(); return _total; }
+  size_t numCentroids() const { compress(); return _centroids.size(); }
+  bool empty() const { return totalWeight() <= 0.; }
+  double min() const { return _min; }
+  double max() const { return _max; }
+
+  /// Value below which a weight fraction @a q of the entries lies.
+  double quantile(double q) const {
+    compress();
+    if(_centroids.empty()) return 0.;
+    if(q <= 0.) return _min;
+    if(q >= 1.) return _max;
+    const double target = q*_total;
+    // Centroid i covers [cum, cum + w_i] with its mean at the centre;
+    // interpolate between neighbouring centres, and to min/max at the ends
+    double cum = 0.;
+    for(size_t i = 0; i < _centroids.size(); i++)
+    {
+        const double w = _centroids[i].weight;
+        const double centre = cum + 0.5*w;
+        if(target < centre)
+        {
+            if(i == 0) return _min + (_centroids[0].mean - _min)*(centre > 0. ? target/centre : 0.);
+            const double prev = cum - 0.5*_centroids[i - 1].weight;
+            const double f = (target - prev)/(centre - prev);
+            return _centroids[i - 1].mean + f*(_centroids[i].mean - _centroids[i - 1].mean);
+        }
+        cum += w;
+    }
+    const Centroid& last = _centroids.back();
+    const double centre = _total - 0.5*last.weight;
+    const double f = (target - centre)/(_total - centre);
+    return last.mean + f*(_max - last.mean);
+  }
+
+  /// Weight fraction of the entries below @a x.
+  double cdf(double x) const {
+    compress();
+    if(_centroids.empty() || x < _min) return 0.;
+    if(x >= _max) return 1.;
+    double cum = 0.;
+    double prevMean = _min, prevCum = 0.;
+    for(const Centroid& c : _centroids)
+    {
+        const double centre = cum + 0.5*c.weight;
+        if(x < c.mean)
+        {
+            const double dx = c.mean - prevMean;
+            return (prevCum + (dx > 0. ? (x - prevMean)/dx : 0.)*(centre - prevCum))/_total;
+        }
+        prevMean = c.mean;
+        prevCum = centre;
+        cum += c.weight;
+    }
+    const double dx = _max - prevMean;
+    return (prevCum + (dx > 0. ? (x - prevMean)/dx : 1.)*(_total - prevCum))/_total;
+  }
+
+  /// Binary representation: compression, min, max, centroid count and
+  /// (mean, weight) pairs.
+  void write(std::ostream& out) const {
+    compress();
+    const uint64_t n = _centroids.size();
+    out.write(reinterpret_cast<const char*>(&_compression), sizeof(double));
+    out.write(reinterpret_cast<const char*>(&_min), sizeof(double));
+    out.write(reinterpret_cast<const char*>(&_max), sizeof(double));
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char*>(_centroids.data()), n*sizeof(Centroid));
+  }
+
+  bool read(std::istream& in) {
+    uint64_t n = 0;
+    in.read(reinterpret_cast<char*>(&_compression), sizeof(double));
+    in.read(reinterpret_cast<char*>(&_min), sizeof(double));
+    in.read(reinterpret_cast<char*>(&_max), sizeof(double));
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if(!in || n > (uint64_t(1) << 32)) return false;
+    _centroids.resize(n);
+    in.read(reinterpret_cast<char*>(_centroids.data()), n*sizeof(Centroid));
+    _buffer.clear();
+    _total = 0.;
+    for(const Centroid& c : _centroids) _total += c.weight;
+    return bool(in);
+  }
+
+private:
+
+  struct Centroid {
+    double mean;
+    double weight;
+  };
+
+  /// Arcsine scale: centroids span at most one unit of k(q).
+  double k(double q) const {
+    return _compression/(2.*M_PI)*std::asin(2.*std::min(std::max(q, 0.), 1.) - 1.);
+  }
+
+  /// Merge the buffered values into the centroids.
+  void compress() const {
+    if(_buffer.empty()) return;
+    _buffer.insert(_buffer.end(), _centroids.begin(), _centroids.end());
+    std::sort(_buffer.begin(), _buffer.end(), [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+    double total = 0.;
+    for(const Centroid& c : _buffer) total += c.weight;
+
+    _centroids.clear();
+    Centroid cur = _buffer[0];
+    double cumBefore = 0.;
+    double kLeft = k(0.);
+    for(size_t i = 1; i < _buffer.size(); i++)
+    {
+        const Centroid& next = _buffer[i];
+        const double qRight = (cumBefore + cur.weight + next.weight)/total;
+        if(k(qRight) - kLeft <= 1.)
+        {
+            cur.mean += (next.mean - cur.mean)*next.weight/(cur.weight + next.weight);
+            cur.weight += next.weight;
+        }
+        else
+        {
+            _centroids.push_back(cur);
+            cumBefore += cur.weight;
+            kLeft = k(cumBefore/total);
+            cur = next;
+        }
+    }
+    _centroids.push_back(cur);
+    _buffer.clear();
+    _total = total;
+  }
+
+  double _compression;
+  double _min = std::numeric_limits<double>::max();
+  double _max = std::numeric_limits<double>::lowest();
+  mutable double _total = 0.;
+  mutable std::vector<Centroid> _centroids;
+  mutable std::vector<Centroid> _buffer;
+
+};
+
+
+/// Named sketches as written by RHIC_2019_CentralityCalibration.
+typedef std::map<std::string, QuantileSketch> QuantileSketches;
+
+inline void writeSketches(const std::string& path, const QuantileSketches& sketches) {
+  std::ofstream out(path, std::ios::binary);
+  if(!out) throw std::runtime_error("QuantileSketch: cannot write " + path);
+  const uint32_t version = 1, n = sketches.size();
+  out.write("RHICSKCH", 8);
+  out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  for(const auto& s : sketches)
+  {
+      const uint32_t len = s.first.size();
+      out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+      out.write(s.first.data(), len);
+      s.second.write(out);
+  }
+}
+
+/// Read the sketches in @a path and merge them into @a sketches.
+inline void mergeSketches(const std::string& path, QuantileSketches& sketches) {
+  std::ifstream in(path, std::ios::binary);
+  char magic[8];
+  uint32_t version = 0, n = 0;
+  in.read(magic, 8);
+  in.read(reinterpret_cast<char*>(&version), sizeof(version));
+  in.read(reinterpret_cast<char*>(&n), sizeof(n));
+  if(!in || std::memcmp(magic, "RHICSKCH", 8) != 0 || version != 1)
+    throw std::runtime_error("QuantileSketch: " + path + " is not a sketch file");
+  for(uint32_t i = 0; i < n; i++)
+  {
+      uint32_t len = 0;
+      in.read(reinterpret_cast<char*>(&len), sizeof(len));
+      if(!in || len > 1024) throw std::runtime_error("QuantileSketch: " + path + " is truncated");
+      std::string name(len, ' ');
+      in.read(&name[0], len);
+      QuantileSketch s;
+      if(!s.read(in)) throw std::runtime_error("QuantileSketch: " + path + " is truncated");
+      auto it = sketches.find(name);
+      if(it == sketches.end()) sketches.emplace(name, s);
+      else it->second.merge(s);
+  }
+}
+
+}
+
+#endif
@@ -3,38 +3,99 @@
 #define RIVET_RHICCENTRALITY_HH
 
 #include "Rivet/Projections/PercentileProjection.hh"
-#include "Rivet/Projections/ChargedFinalState.hh"
+#include "Rivet/Projections/FinalState.hh"
+#include "Rivet/Projections/ImpactParameterProjection.hh"
 #include "Rivet/Tools/RivetYODA.hh"
 #include "Rivet/Tools/Cuts.hh"
 #include <map>
 
 namespace Rivet {
 
+/// @brief All RHIC/LHC centrality estimators from one pass over the final state.
+///
+/// The projection has no configuration, so every RHICCentrality in a job
+/// (e.g. STAR and PHENIX analyses run together) shares one instance and
+/// the final state is scanned once per event for all of them.
+class RHICEstimators: public Projection {
+
+public:
+
+  /// The estimators, in the order of operator[].
+  enum Estimator {
+    MIDMULT = 0,  ///< charged multiplicity |eta| < 0.5 (STAR)
+    FWDMULT,      ///< charged multiplicity 3.1 < |eta| < 3.9 (PHENIX BBC)
+    FWDET,        ///< charged sum E_T 3 < |eta| < 5 (CMS HF)
+    IMPACT,       ///< generated impact parameter
+    NESTIMATORS
+  };
+
+  RHICEstimators() {
+    setName("RHICEstimators");
+    declare(FinalState(), "FS");
+    declare(ImpactParameterProjection(), "IMP");
+  }
+
+  DEFAULT_RIVET_PROJ_CLONE(RHICEstimators);
+
+  /// Name of estimator @a i, as used by RHICCentrality.
+  static const std::string& name(int i) {
+    static const std::string names[NESTIMATORS] = {"STAR", "PHENIX", "CMS", "IMP"};
+    return names[i];
+  }
+
+  /// Value of estimator @a i in the current event.
+  double operator[](int i) const { return _values[i]; }
+
+protected:
+
+  void project(const Event& e) {
+    double mid = 0., fwd = 0., et = 0.;
+    for(const Particle& p : apply<FinalState>(e, "FS").particles())
+    {
+        if(!p.isCharged()) continue;
+        const double aeta = p.abseta();
+        mid += (aeta < 0.5);
+        fwd += (aeta > 3.1 && aeta < 3.9);
+        if(aeta > 3. && aeta < 5.) et += p.Et();
+    }
+    _values[MIDMULT] = mid;
+    _values[FWDMULT] = fwd;
+    _values[FWDET] = et;
+    _values[IMPACT] = apply<SingleValueProjection>(e, "IMP")();
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection& p) const {
+    return mkNamedPCmp(p, "FS");
+  }
+
+private:
+
+  double _values[NESTIMATORS] = {};
+
+};
+
+
 class RHICCentrality: public SingleValueProjection {
 
 public:
 
   /// Default constructor.
+  ///
+  /// @a name selects the estimator returned by operator(): "STAR",
+  /// "PHENIX", "CMS" or "IMP". All estimators are available through
+  /// operator[], computed by the shared RHICEstimators projection.
   RHICCentrality(const std::string& name) {
-    Cut c = Cuts::open();
-    if(name == "STAR")
-    {
-        c = Cuts::abseta < 0.5;
-        expName = "RHIC";
-    }
-    else if(name == "PHENIX")
-    {
-        c = Cuts::abseta > 3.1 && Cuts::abseta < 3.9;
-        expName = "RHIC";
-    }
-    else if(name == "CMS")
+    for(int i = 0; i < RHICEstimators::NESTIMATORS; i++)
     {
-        c = Cuts::abseta > 3 && Cuts::abseta < 5;
-        expName = "CMS";
+        _projNames.push_back(RHICEstimators::name(i));
+        if(name == RHICEstimators::name(i)) _estimator = i;
     }
-    
+    if(_estimator < 0) throw UserError("RHICCentrality: unknown estimator " + name + ", use STAR, PHENIX, CMS or IMP");
+    expName = (name == "CMS") ? "CMS" : "RHIC";
+
     setName(name);
-    declare(ChargedFinalState(c), "CFS");
+    declare(RHICEstimators(), "Estimators");
 
 }
 
@@ -43,9 +104,9 @@ public:
 
   /// @BRIEF Add a new centality estimate.
   ///
-  /// The SingelValueProjection, @a p, should return a value between 0
-  /// and 100, and the @a pname should be one of "REF", "GEN", "IMP",
-  /// "USR", or "RAW", as described above.
+  /// The SingelValueProjection, @a p, is evaluated together with the
+  /// built-in estimators and appended after them in operator[], in the
+  /// order the projections were added.
   void add(const SingleValueProjection & p, string pname) {
     _projNames.push_back(pname);
     declare(p, pname);
@@ -55,37 +116,27 @@ public:
   /// Perform the projection
     void project(const Event& e) {
       clear();
-      double estimate = 0;
-      
-      
-      if(expName == "RHIC")
+      const RHICEstimators& est = apply<RHICEstimators>(e, "Estimators");
+      _values.resize(_projNames.size());
+      for(int i = 0; i < RHICEstimators::NESTIMATORS; i++) _values[i] = est[i];
+      for(size_t i = RHICEstimators::NESTIMATORS; i < _projNames.size(); i++)
       {
-          estimate = apply<FinalState>(e, "CFS").particles().size();
-          
+          _values[i] = apply<SingleValueProjection>(e, _projNames[i])();
       }
-      else if(expName == "CMS")
-      {
-          const Particles& particles = applyProjection<ChargedFinalState>(e, "CFS").particles();
-          for(const Particle& p : particles)
-          {
-              estimate += p.Et();
-          }
-              
-          
-      }
-      
-      //cout << "Estimate: " << estimate << endl;
-      set(estimate);
+
+      //cout << "Estimate: " << _values[_estimator] << endl;
+      set(_values[_estimator]);
     }
 
   /// Cheek if no internal projections have been added.
   bool empty() const {
-    return _projNames.empty();
+    return _projNames.size() == size_t(RHICEstimators::NESTIMATORS);
   }
 
-  /// Return the percentile of the @a i'th projection.
+  /// Return the value of the @a i'th estimator, in the order of
+  /// projections(): STAR, PHENIX, CMS, IMP, then any added ones.
   ///
-  /// Note that operator() will return the zero'th projection.
+  /// Note that operator() will return the one selected by name.
   double operator[](int i) const {
     return _values[i];
   }
@@ -93,7 +144,14 @@ public:
   // Standard comparison function.
   /// Compare projections.
     CmpState compare(const Projection& p) const {
-      return mkNamedPCmp(p, "CFS");
+      const RHICCentrality& other = dynamic_cast<const RHICCentrality&>(p);
+      if(_projNames != other._projNames) return CmpState::NEQ;
+      CmpState state = mkNamedPCmp(p, "Estimators") || cmp(_estimator, other._estimator);
+      for(size_t i = RHICEstimators::NESTIMATORS; i < _projNames.size(); i++)
+      {
+          state = state || mkNamedPCmp(p, _projNames[i]);
+      }
+      return state;
     }
 
   /// The list of names of the internal projections.
@@ -106,11 +164,14 @@ private:
   /// The list of names of the internal projections.
   vector<string> _projNames;
 
-  /// The list of percentiles resulting from the last projection.
+  /// The list of estimates resulting from the last projection.
   vector<double> _values;
-  
+
   string expName = "";
 
+  /// Index of the estimator returned by operator().
+  int _estimator = -1;
+
 };
 
 }
@@ -4,6 +4,8 @@
 #include "Rivet/Projections/SingleValueProjection.hh"
 #include "Rivet/Projections/ImpactParameterProjection.hh"
 #include "RHICCentrality.hh"
+#include "CentralityTable.hh"
+#include "QuantileSketch.hh"
 #include "Rivet/Config/RivetCommon.hh"
 #include "Rivet/AnalysisHandler.hh"
 #include "Rivet/AnalysisInfo.hh"
@@ -29,6 +31,12 @@ class RHIC_2019_CentralityCalibration : public Analysis {
     set<string> done;  
     MSG_INFO("RHIC Experiment: " << experiment);  
     declare(RHICCentrality(experiment), "Centrality");
+    _experiment = experiment;
+    // Optional binary percentile table for analyses run with centtable=FILE
+    _tableFile = getOption<string>("table", "");
+    // Optional mergeable quantile sketches of both distributions, merged
+    // over parallel jobs with tools/mergeCentralitySketch
+    _sketchFile = getOption<string>("sketch", "");
     declare(ImpactParameterProjection(), "IMP");
 
     // The calibration histogram:
@@ -53,15 +61,46 @@ class RHIC_2019_CentralityCalibration : public Analysis {
     // parameter, assumes that the generator does not describe the
     // full final state, and should therefore be filled even if the
     // event is not triggered.
-      _impcalib->fill(apply<SingleValueProjection>(event, "IMP")());
+      const double imp = apply<SingleValueProjection>(event, "IMP")();
+      const double est = apply<SingleValueProjection>(event, "Centrality")();
+      _impcalib->fill(imp);
       
-      _calib->fill(apply<SingleValueProjection>(event, "Centrality")());
+      _calib->fill(est);
+
+      const double w = event.weights()[0];
+      _sketches["CMULT_IMP"].add(imp, w);
+      _sketches["CMULT"].add(est, w);
     
   }
   
   /// Finalize
   void finalize() {
 
+    if(!_sketchFile.empty())
+    {
+      writeSketches(_sketchFile, _sketches);
+      MSG_INFO("Wrote centrality sketches " << _sketchFile);
+    }
+    if(!_tableFile.empty())
+    {
+      // Knots at fine quantiles of the sketch, free of the CMULT binning
+      const QuantileSketch& sketch = _sketches["CMULT"];
+      if(sketch.empty()) CentralityTable::write(_tableFile, _experiment, *_calib);
+      else
+      {
+        vector<double> x, cdf;
+        for(int i = 0; i <= 1000; i++)
+        {
+          const double v = sketch.quantile(i/1000.);
+          if(!x.empty() && v <= x.back()) continue;
+          x.push_back(v);
+          cdf.push_back(i/1000.);
+        }
+        if(x.size() < 2) CentralityTable::write(_tableFile, _experiment, *_calib);
+        else CentralityTable::write(_tableFile, _experiment, x, cdf);
+      }
+      MSG_INFO("Wrote centrality table " << _tableFile);
+    }
     _calib->normalize();
     _impcalib->normalize();
 
@@ -70,6 +109,13 @@ class RHIC_2019_CentralityCalibration : public Analysis {
   /// The calibration histograms.
   Histo1DPtr _calib;
   Histo1DPtr _impcalib;
+
+  string _experiment;
+  string _tableFile;
+  string _sketchFile;
+
+  /// Nominal-weight sketches of the estimator and impact parameter.
+  QuantileSketches _sketches;
   };
 
   // The hook for the plugin system
@@ -0,0 +1,168 @@
+// -*- C++ -*-
+#ifndef RIVET_SELFCALIBRATINGCENTRALITY_HH
+#define RIVET_SELFCALIBRATINGCENTRALITY_HH
+
+#include "CentralityTable.hh"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Centrality calibrated on the fly from the analysed events.
+///
+/// Replaces the separate RHIC_2019_CentralityCalibration run. During a
+/// warm-up the analysis buffers one compact record per event: the raw
+/// estimator value, the event weights and the few numbers it would fill
+/// (e.g. particle pTs). Every quarter of the minimum warm-up the estimator
+/// values at the centrality class edges are recomputed from the buffer;
+/// once they move by less than the tolerance (or the buffer is full) the
+/// percentile table is frozen and later events are analysed directly.
+///
+/// The event that freezes the table makes buffer() return true, and the
+/// analysis then fills the buffered events with replay() from analyze(),
+/// so they reach the raw histograms of every weight stream. Events of a
+/// run that ends before the warm-up does are not filled.
+class SelfCalibratingCentrality {
+
+public:
+
+  /// Warm-up of at least @a minEvents and at most @a maxEvents events,
+  /// converged when the estimator values at the percentiles @a edges
+  /// change by less than the relative tolerance @a tol between checks.
+  SelfCalibratingCentrality(size_t minEvents, size_t maxEvents,
+                            const std::vector<double>& edges = {5., 10., 20., 40., 60.}, double tol = 0.005)
+    : _minEvents(std::max<size_t>(minEvents, 2)), _maxEvents(std::max(maxEvents, minEvents)),
+      _edges(edges), _tol(tol) {
+    _checkEvery = std::max<size_t>(_minEvents/4, 1);
+    _offset.push_back(0);
+  }
+
+  /// Whether the percentile table is frozen.
+  bool calibrated() const { return _table.valid(); }
+
+  /// Centrality percentile of estimator value @a est, 0 being most central.
+  double percentile(double est) const { return _table.percentile(est); }
+
+  /// The percentile table, valid once calibrated().
+  const CentralityTable& table() const { return _table; }
+
+  size_t numBuffered() const { return _est.size(); }
+
+  /// Buffer an event with estimator value @a est, the weights @a w of all
+  /// weight streams (nominal first) and the @a n values @a values it fills.
+  /// Returns true if this event froze the calibration.
+  bool buffer(double est, const std::vector<double>& w, const float* values, size_t n) {
+    if(_est.empty()) _numWeights = w.size();
+    else if(w.size() != _numWeights) throw UserError("SelfCalibratingCentrality: the number of event weights changed");
+    _est.push_back(est);
+    _weights.insert(_weights.end(), w.begin(), w.end());
+    _values.insert(_values.end(), values, values + n);
+    _offset.push_back(_values.size());
+    if(_est.size() >= _minEvents && _est.size() % _checkEvery == 0) check();
+    if(!calibrated() && _est.size() >= _maxEvents) calibrate();
+    return calibrated();
+  }
+
+  bool buffer(double est, const std::vector<double>& w, const std::vector<float>& values) {
+    return buffer(est, w, values.data(), values.size());
+  }
+
+  /// Call @a fill(percentile, weights, values, n) for every buffered
+  /// event, with weights pointing to its numWeights() weights, then free
+  /// the buffer. To be called from analyze() once buffer() returned true.
+  template <typename FILL>
+  void replay(FILL fill) {
+    if(!calibrated()) return;
+    for(size_t i = 0; i < _est.size(); i++)
+    {
+        fill(_table.percentile(_est[i]), _weights.data() + i*_numWeights,
+             _values.data() + _offset[i], _offset[i + 1] - _offset[i]);
+    }
+    std::vector<float>().swap(_est);
+    std::vector<double>().swap(_weights);
+    std::vector<float>().swap(_values);
+    std::vector<size_t>(1, 0).swap(_offset);
+  }
+
+  /// Number of weight streams of the buffered events.
+  size_t numWeights() const { return _numWeights; }
+
+private:
+
+  /// Build the knots from the buffer: distinct estimator values with the
+  /// weight fraction below them, ties counted half.
+  void knots(std::vector<double>& x, std::vector<double>& cdf) const {
+    std::vector<uint32_t> order(_est.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) { return _est[a] < _est[b]; });
+    double total = 0.;
+    for(size_t i = 0; i < _est.size(); i++) total += nominal(i);
+    x.clear();
+    cdf.clear();
+    double below = 0.;
+    for(size_t i = 0; i < order.size();)
+    {
+        const float v = _est[order[i]];
+        double w = 0.;
+        for(; i < order.size() && _est[order[i]] == v; i++) w += nominal(order[i]);
+        x.push_back(v);
+        cdf.push_back(total > 0. ? (below + 0.5*w)/total : 0.);
+        below += w;
+    }
+  }
+
+  /// Nominal weight of buffered event @a i, which the calibration uses.
+  double nominal(size_t i) const { return _weights[i*_numWeights]; }
+
+  bool buildTable(CentralityTable& table) const {
+    std::vector<double> x, cdf;
+    knots(x, cdf);
+    if(x.size() < 2) return false;
+    table.assign(x, cdf);
+    return true;
+  }
+
+  void calibrate() {
+    buildTable(_table);
+  }
+
+  /// Freeze the table if the class edges have converged.
+  void check() {
+    CentralityTable trial;
+    if(!buildTable(trial)) return;
+    std::vector<double> values;
+    for(double pct : _edges) values.push_back(trial.value(pct));
+    bool converged = (_lastEdges.size() == values.size());
+    for(size_t i = 0; converged && i < values.size(); i++)
+    {
+        converged = std::fabs(values[i] - _lastEdges[i]) <= _tol*std::max(std::fabs(_lastEdges[i]), 1.);
+    }
+    _lastEdges = values;
+    if(converged) calibrate();
+  }
+
+  size_t _minEvents;
+  size_t _maxEvents;
+  size_t _checkEvery;
+  std::vector<double> _edges;
+  double _tol;
+  std::vector<double> _lastEdges;
+
+  CentralityTable _table;
+
+  /// Buffered events; event i owns _weights[i*_numWeights, (i+1)*_numWeights)
+  /// and _values[_offset[i], _offset[i+1]).
+  std::vector<float> _est;
+  size_t _numWeights = 1;
+  std::vector<double> _weights;
+  std::vector<float> _values;
+  std::vector<size_t> _offset;
+
+};
+
+}
+
+#endif
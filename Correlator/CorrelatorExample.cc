@@ -13,6 +13,7 @@
 #include <math.h>
 #include <vector>
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 #define _USE_MATH_DEFINES
 
@@ -292,20 +293,6 @@ namespace Rivet {
       }
 
 
-      bool isSecondary(Particle p)
-      {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-          p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-          p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-          p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-          p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-          p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-          p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-          return true;
-        else return false;
-
-      }
     double CalculateVn(YODA::Histo1D& hist, int nth)
     {
         int nBins = hist.numBins();
@@ -400,7 +387,7 @@ namespace Rivet {
         const ChargedFinalState cfs(Cuts::abseta < 0.35 && Cuts::pT > 0.5*GeV);
         declare(cfs, "CFS");
 
-        declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+        DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
 	book(_h["DeltaPhi"], "DeltaPhi", 36, -M_PI/2., 1.5*M_PI);
 	book(_c["sow_AuAu200"], "sow_AuAu200");
@@ -7,6 +7,8 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "Rivet/Projections/PrimaryParticles.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "EventShapeEngineering.hh"
 //#include "Rivet/Projections/EventPlane.hh"
 #include <cmath>
 #include <iostream>
@@ -299,6 +301,32 @@ namespace Rivet {
         return funcRes;
     }
 
+    /// Fill the v2 of an event in the q_2 classes from its record: the RxP
+    /// sub-event correlation, then (pT, cos 2(phi - Psi_2)) per particle.
+    /// Without @a weights it is the current event; a replayed event passes
+    /// its own weights, filled into each weight stream.
+    void FillESE(double c, double q2pct, const float* values, size_t n, const double* weights = nullptr)
+    {
+        string sel;
+        if(q2pct >= 0. && q2pct < 10.) sel = "q2high";
+        else if(q2pct >= 90.) sel = "q2low";
+        else return;
+
+        Profile1DPtr& pCos = _p["RxPcosPos_" + sel];
+        Profile1DPtr& pV2 = _p["v2_cent" + Form(floor(c/10)*10., 0) + Form((floor(c/10)*10.)+10., 0) + "_" + sel];
+        if(!weights)
+        {
+                pCos->fill(int(floor(c/10))+0.5, values[0]);
+                for(size_t i = 1; i + 1 < n; i += 2) pV2->fill(values[i], values[i+1]);
+                return;
+        }
+        for(size_t iw = 0; iw < _ese->numWeights(); iw++)
+        {
+                pCos.get()->persistent(iw)->fill(int(floor(c/10))+0.5, values[0], weights[iw]);
+                for(size_t i = 1; i + 1 < n; i += 2) pV2.get()->persistent(iw)->fill(values[i], values[i+1], weights[iw]);
+        }
+    }
+
     string Form(double number, int precision)
     {
             std::stringstream stream;
@@ -315,7 +343,7 @@ namespace Rivet {
 
       // Initialise and register projections
 
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
       const FinalState fs(Cuts::abseta < 0.5 && Cuts::pT > 0.150*GeV);
       declare(fs, "fs");
@@ -329,6 +357,15 @@ namespace Rivet {
       const FinalState RxPNeg(Cuts::eta < -1. && Cuts::eta > -2.8);
       declare(RxPNeg, "RxPNeg");
 
+      // ese=N: v2 in the 10% of events with the largest and the smallest RxP q_2
+      // per centrality class, q_2 percentiles calibrated online after N events
+      const int eseWarmup = getOption<int>("ese", -1);
+      if(eseWarmup >= 0)
+      {
+              declare(ESEProjection(RxPPos, RxPNeg, 2), "ESE");
+              _ese = make_shared<ESECalibration>(v2centBins, eseWarmup);
+      }
+
       book(_p["RxPcosPos"], "RxPcosPos", 10, 0., 10.);
       book(_p["RxPcosPosv3"], "RxPcosPosv3", 10, 0., 10.);
       book(_s["ResCent"], "ResCent");
@@ -341,6 +378,17 @@ namespace Rivet {
 
               string v3string = "v3_cent" + Form(v2centBins[icent], 0) + Form(v2centBins[icent+1], 0);
               book(_p[v3string], v3string,  v2ptBins);
+
+              if(_ese)
+              {
+                      book(_p[v2string + "_q2high"], v2string + "_q2high", v2ptBins);
+                      book(_p[v2string + "_q2low"], v2string + "_q2low", v2ptBins);
+              }
+      }
+      if(_ese)
+      {
+              book(_p["RxPcosPos_q2high"], "RxPcosPos_q2high", 10, 0., 10.);
+              book(_p["RxPcosPos_q2low"], "RxPcosPos_q2low", 10, 0., 10.);
       }
 
 
@@ -395,6 +443,33 @@ namespace Rivet {
       string v3string = "v3_cent" + Form(floor(c/10)*10., 0) + Form((floor(c/10)*10.)+10., 0);
       FillVn(_p[v3string], particles, evPPosNegv3, 3);
 
+      if(_ese)
+      {
+              // One record per event; buffered until the q_2 percentiles of its
+              // centrality class are calibrated
+              vector<float> values = {float(cos(2*(evPPos-evPNeg)))};
+              values.reserve(1 + 2*particles.size());
+              for(const Particle& p : particles)
+              {
+                      values.push_back(p.pT()/GeV);
+                      values.push_back(cos(2*(p.phi() - evPPosNeg)));
+              }
+              const double q2 = apply<ESEProjection>(event, "ESE").q();
+              const auto& weights = event.weights();
+              double q2pct = -1.;
+              if(_ese->add(c, q2, vector<double>(std::begin(weights), std::end(weights)), values, q2pct))
+              {
+                      FillESE(c, q2pct, values.data(), values.size());
+              }
+              else if(_ese->calibrated(c))
+              {
+                      // This event ended the warm-up of its class
+                      _ese->replay(c, [&](double bc, double bq2pct, const double* w, const float* bvalues, size_t n) {
+                              FillESE(bc, bq2pct, bvalues, n, w);
+                      });
+              }
+      }
+
 
     }
 
@@ -402,6 +477,12 @@ namespace Rivet {
     /// Normalise histograms etc., after the run
     void finalize() {
 
+            if(_ese && _ese->numBuffered() > 0)
+            {
+                    MSG_WARNING("ese: " << _ese->numBuffered() << " events of centrality classes "
+                                << "that did not finish the q_2 warm-up were not filled");
+            }
+
             int centBin = 0;
 
             std::vector<double> EPres(5, 0.);
@@ -449,6 +530,23 @@ namespace Rivet {
 
             }
 
+            //The q_2 selection biases the resolution, so it is taken from the same events
+            for(const string sel : {"q2high", "q2low"})
+            {
+                    if(!_ese) break;
+                    centBin = 0;
+                    for(auto bin : _p["RxPcosPos_" + sel]->bins())
+                    {
+                            if(centBin < int(v2centBins.size())-1 && bin.numEntries() > 0 && bin.mean() > 0.)
+                            {
+                                    double res = Resolution(sqrt(2)*CalculateChi(sqrt(bin.mean())));
+                                    string v2string = "v2_cent" + Form(v2centBins[centBin], 0) + Form(v2centBins[centBin+1], 0) + "_" + sel;
+                                    _p[v2string]->scaleY(1./res);
+                            }
+                            centBin++;
+                    }
+            }
+
 
     }
 
@@ -464,6 +562,8 @@ namespace Rivet {
     std::vector<double> v2centBins = {0., 10., 20., 30., 40., 50.};
     //@}
 
+    shared_ptr<ESECalibration> _ese;
+
 
   };
 
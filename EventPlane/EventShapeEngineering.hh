@@ -0,0 +1,227 @@
+// -*- C++ -*-
+#ifndef RIVET_EVENTSHAPEENGINEERING_HH
+#define RIVET_EVENTSHAPEENGINEERING_HH
+
+#include "Rivet/Projection.hh"
+#include "Rivet/Projections/FinalState.hh"
+#include "../Centralities/QuantileSketch.hh"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Flow vector of two forward sub-detectors for event-shape engineering.
+///
+/// The n-th harmonic flow vectors Q_n = sum_j e^{i n phi_j} of the north
+/// and south sub-detectors are accumulated in one pass over their
+/// particles. The reduced magnitude q_n = |Q_n|/sqrt(M) of the combined
+/// vector selects events of similar centrality by their flow; the event
+/// plane and the two sub-event planes give the resolution.
+class ESEProjection: public Projection {
+
+public:
+
+  enum SubEvent { NORTH = 0, SOUTH, BOTH };
+
+  /// Flow vectors of harmonic @a harmonic from the particles of @a north
+  /// and @a south, e.g. the two RxP sides 1 < |eta| < 2.8.
+  ESEProjection(const FinalState& north, const FinalState& south, int harmonic = 2)
+    : _harmonic(harmonic) {
+    setName("ESEProjection");
+    declare(north, "North");
+    declare(south, "South");
+  }
+
+  DEFAULT_RIVET_PROJ_CLONE(ESEProjection);
+
+  int harmonic() const { return _harmonic; }
+
+  /// Number of particles in @a sub.
+  double mult(SubEvent sub = BOTH) const { return _mult[sub]; }
+
+  double Qx(SubEvent sub = BOTH) const { return _qx[sub]; }
+  double Qy(SubEvent sub = BOTH) const { return _qy[sub]; }
+
+  /// Reduced flow vector magnitude |Q_n|/sqrt(M), 0 without particles.
+  double q(SubEvent sub = BOTH) const {
+    return _mult[sub] > 0. ? std::sqrt((_qx[sub]*_qx[sub] + _qy[sub]*_qy[sub])/_mult[sub]) : 0.;
+  }
+
+  /// Event-plane angle in [0, 2pi/n).
+  double psi(SubEvent sub = BOTH) const {
+    return mapAngle0To2Pi(std::atan2(_qy[sub], _qx[sub]))/_harmonic;
+  }
+
+protected:
+
+  void project(const Event& e) {
+    const Particles& north = apply<FinalState>(e, "North").particles();
+    const Particles& south = apply<FinalState>(e, "South").particles();
+    accumulate(north, NORTH);
+    accumulate(south, SOUTH);
+    _mult[BOTH] = _mult[NORTH] + _mult[SOUTH];
+    _qx[BOTH] = _qx[NORTH] + _qx[SOUTH];
+    _qy[BOTH] = _qy[NORTH] + _qy[SOUTH];
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection& p) const {
+    const ESEProjection& other = dynamic_cast<const ESEProjection&>(p);
+    return mkNamedPCmp(p, "North") || mkNamedPCmp(p, "South") || cmp(_harmonic, other._harmonic);
+  }
+
+private:
+
+  void accumulate(const Particles& particles, SubEvent sub) {
+    double qx = 0., qy = 0.;
+    for(const Particle& p : particles)
+    {
+        const double phi = _harmonic*p.phi();
+        qx += std::cos(phi);
+        qy += std::sin(phi);
+    }
+    _mult[sub] = particles.size();
+    _qx[sub] = qx;
+    _qy[sub] = qy;
+  }
+
+  int _harmonic;
+  double _mult[3] = {0., 0., 0.};
+  double _qx[3] = {0., 0., 0.};
+  double _qy[3] = {0., 0., 0.};
+
+};
+
+
+/// @brief Online q_n percentiles per centrality class.
+///
+/// Keeps one streaming quantile sketch of q_n per centrality class, so
+/// ESE classes (e.g. the 10% of events with the largest q_2) are defined
+/// in the same job as the observables instead of a second pass. The q_n
+/// percentile is 100 (1 - F(q_n)), i.e. 0-10% holds the largest q_n, the
+/// same convention as the centrality percentile.
+///
+/// Until a centrality class has seen @a warmup events its percentiles
+/// are not trusted: its events are buffered as compact records (centrality,
+/// q_n, weights and the values the analysis fills). The event that ends
+/// the warm-up of a class is the last one buffered; the analysis then
+/// fills the class' buffer with replay() from analyze(), so the events
+/// reach the raw histograms of every weight stream. After the warm-up the
+/// percentile of each event is taken from the sketch as it stands, which
+/// keeps absorbing events. With @a warmup 0 all events are classified
+/// online. Events of a class whose warm-up never ends are not filled.
+class ESECalibration {
+
+public:
+
+  /// Centrality classes [@a centEdges[i], @a centEdges[i+1]).
+  ESECalibration(const std::vector<double>& centEdges, size_t warmup = 0, double compression = 200.)
+    : _centEdges(centEdges), _warmup(warmup),
+      _sketches(centEdges.size() > 1 ? centEdges.size() - 1 : 0, QuantileSketch(compression)),
+      _seen(_sketches.size(), 0), _buffers(_sketches.size()) { }
+
+  size_t numClasses() const { return _sketches.size(); }
+
+  /// Centrality class of percentile @a cent, -1 outside the edges.
+  int centralityClass(double cent) const {
+    if(_centEdges.size() < 2 || cent < _centEdges.front() || cent >= _centEdges.back()) return -1;
+    return int(std::upper_bound(_centEdges.begin(), _centEdges.end(), cent) - _centEdges.begin()) - 1;
+  }
+
+  /// Whether the class of @a cent is past its warm-up.
+  bool calibrated(double cent) const {
+    const int ic = centralityClass(cent);
+    return ic >= 0 && _seen[ic] >= _warmup;
+  }
+
+  /// q_n percentile of @a q in the class of @a cent, -1 outside the classes.
+  double percentile(double cent, double q) const {
+    const int ic = centralityClass(cent);
+    if(ic < 0 || _sketches[ic].empty()) return -1.;
+    return 100.*(1. - _sketches[ic].cdf(q));
+  }
+
+  /// Add an event with centrality @a cent, q_n @a q and the weights @a w of
+  /// all weight streams (nominal first, which the sketch uses). If its
+  /// class is past the warm-up, return true with the percentile in @a pct;
+  /// otherwise buffer it with the @a n values @a values and return false.
+  bool add(double cent, double q, const std::vector<double>& w, const float* values, size_t n, double& pct) {
+    const int ic = centralityClass(cent);
+    if(ic < 0) return false;
+    _sketches[ic].add(q, w[0]);
+    if(++_seen[ic] > _warmup)
+    {
+        pct = percentile(cent, q);
+        return true;
+    }
+    if(_numBuffered == 0) _numWeights = w.size();
+    else if(w.size() != _numWeights) throw UserError("ESECalibration: the number of event weights changed");
+    Buffer& b = _buffers[ic];
+    b.cent.push_back(cent);
+    b.q.push_back(q);
+    b.weights.insert(b.weights.end(), w.begin(), w.end());
+    b.values.insert(b.values.end(), values, values + n);
+    b.offset.push_back(b.values.size());
+    _numBuffered++;
+    return false;
+  }
+
+  bool add(double cent, double q, const std::vector<double>& w, const std::vector<float>& values, double& pct) {
+    return add(cent, q, w, values.data(), values.size(), pct);
+  }
+
+  /// Call @a fill(centrality, percentile, weights, values, n) for every
+  /// buffered event of the class of @a cent, with weights pointing to its
+  /// numWeights() weights, then free that buffer. To be called from
+  /// analyze() once calibrated(@a cent), after the add() that ended the
+  /// warm-up.
+  template <typename FILL>
+  void replay(double cent, FILL fill) {
+    const int ic = centralityClass(cent);
+    if(ic < 0 || _seen[ic] < _warmup) return;
+    Buffer& b = _buffers[ic];
+    for(size_t i = 0; i < b.cent.size(); i++)
+    {
+        fill(b.cent[i], percentile(b.cent[i], b.q[i]), b.weights.data() + i*_numWeights,
+             b.values.data() + b.offset[i], b.offset[i + 1] - b.offset[i]);
+    }
+    _numBuffered -= b.cent.size();
+    b = Buffer();
+  }
+
+  /// Number of weight streams of the buffered events.
+  size_t numWeights() const { return _numWeights; }
+
+  /// Number of events still buffered.
+  size_t numBuffered() const { return _numBuffered; }
+
+  /// The q_n sketch of centrality class @a ic.
+  const QuantileSketch& sketch(size_t ic) const { return _sketches[ic]; }
+
+private:
+
+  std::vector<double> _centEdges;
+  size_t _warmup;
+  std::vector<QuantileSketch> _sketches;
+  std::vector<size_t> _seen;
+
+  /// Buffered events of a class; event i owns
+  /// weights[i*_numWeights, (i+1)*_numWeights) and values[offset[i], offset[i+1]).
+  struct Buffer {
+    std::vector<double> cent;
+    std::vector<float> q;
+    std::vector<double> weights;
+    std::vector<float> values;
+    std::vector<size_t> offset = {0};
+  };
+
+  std::vector<Buffer> _buffers;
+  size_t _numBuffered = 0;
+  size_t _numWeights = 1;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,51 @@
+#!/bin/bash
+#Fan-out version of RunFIFO.sh: NGENERATORS runPythia processes, each with its own seed and FIFO,
+#all read by one rivetFanIn process (compile it from ../tools/rivetFanIn.cc), which loads the
+#analysis and the calibration once and takes the events of whichever generator has one ready.
+#Request one core per generator plus one for rivetFanIn, e.g. qsub -I -l nodes=1:ppn=9 -q debug
+#Copy the runPythia file to the same directory where you have your Rivet Analysis
+#On ACF you can find runPythia here: /lustre/haven/proj/UTK0019/Rivet
+#Change the name "PHENIX_2008_I778168" to your Rivet Analysis
+#Have your centrality calibration file in the same folder or point $CALIBRATION to the right path/file
+ANALYSIS="PHENIX_2008_I778168"
+ANALYSIS_DIR=$PWD
+source /lustre/haven/proj/UTK0019/Rivet/rivet.sh
+rm RivetPHENIX_2008_I778168.so
+rivet-build RivetPHENIX_2008_I778168.so PHENIX_2008_I778168.cc
+#Number of generator processes
+NGENERATORS="8"
+#Number of events per generator
+NEVENTS="100"
+#Beams
+BEAM1="Au"
+BEAM2="Au"
+#Energy in the center of mass system
+CMS_ENERGY="200"
+#First Pythia seed, generator k uses GENERATOR_SEED+k. If 0 a random first seed is drawn
+GENERATOR_SEED="0"
+#Min and max pT-hard. if PTHARDMIN > PTHARDMAX then pythia switches to minimum bias (No pt-hard)
+PTHARDMIN="0"
+PTHARDMAX="-1"
+#Centrality Calibration file
+CALIBRATION="calibration_PHENIX_AuAu62GeV.yoda"
+#Flags of your analysis (Ex. centrality: cent=GEN)
+RIVET_FLAGS=":cent=GEN"
+if [ "$GENERATOR_SEED" == "0" ]; then
+    #Pythia seeds go up to 900000000
+    GENERATOR_SEED=$(( (RANDOM * 32768 + RANDOM) % (900000000 - NGENERATORS) + 1 ))
+fi
+FIFOS=""
+for (( k=0; k<NGENERATORS; k++ )); do
+    SEED=$(( GENERATOR_SEED + k ))
+    FIFOFILE="fifo$ANALYSIS.$SEED.hepmc"
+    rm -f /tmp/$FIFOFILE
+    mkfifo /tmp/$FIFOFILE
+    ./runPythia /tmp $FIFOFILE $NEVENTS $BEAM1 $BEAM2 $CMS_ENERGY $SEED $PTHARDMIN $PTHARDMAX > runPythia.$SEED.log 2>&1 &
+    FIFOS="$FIFOS /tmp/$FIFOFILE"
+done
+#Analysis state written to Rivet.ckpt.yoda every CHECKPOINT_EVERY events, so a job killed at its
+#wall time leaves a partial result; rerunning this script resumes and appends to it
+CHECKPOINT_EVERY="10000"
+rivetFanIn --pwd -p $CALIBRATION -a $ANALYSIS$RIVET_FLAGS -o Rivet.yoda --checkpoint Rivet.ckpt.yoda --every $CHECKPOINT_EVERY --resume $FIFOS
+wait
+rm -f $FIFOS
@@ -9,6 +9,8 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 //#include "Rivet/Projections/LeadingParticlesFinalState"
 #include "Rivet/Math/MathUtils.hh"
+#include "../Jets/JetFlow.hh"
+#include "../Jets/JewelSubtraction.hh"
 //#include "Rivet/HeavyIonAnalysis.hh"
 //#include "Rivet/Projections/ALICEToolsHI.hh"
 
@@ -42,8 +44,16 @@ namespace Rivet {
       // the final-state particles declared above are clustered using FastJet with
       // the anti-kT algorithm and a jet-radius parameter 0.4
       // muons and neutrinos are excluded from the clustering
-      FastJets jetcfs(cfs, FastJets::ANTIKT, 0.2, JetAlg::Muons::NONE, JetAlg::Invisibles::NONE);
+      // jet radius and jet-pT binning of the v2 measurement are options,
+      // e.g. ALICE_2019_JETV2:R=0.4:PTMAX=200:NPT=20
+      const double jetR = getOption<double>("R", 0.2);
+      FastJets jetcfs(cfs, FastJets::ANTIKT, jetR, JetAlg::Muons::NONE, JetAlg::Invisibles::NONE);
       declare(jetcfs, "jets");
+      // JEWEL samples with recoils: subtract the thermal scattering centres
+      // from the clustered jets, JEWEL=4MOM (per jet) or JEWEL=GRID (per cell)
+      declare(JewelSubtraction(getOption<string>("JEWEL", "OFF")), "jewel");
+      _jetR = jetR;
+      _jetFlow = make_shared<JetFlow>(getOption<double>("PTMIN", 0.), getOption<double>("PTMAX", 150.), getOption<int>("NPT", 15));
 
       // Book histograms
       book(_h["num_part"], "N_Particles", 500, 0, 500);
@@ -52,21 +62,6 @@ namespace Rivet {
       book(_h["jet_pt"], "Jet_Momentum_Spectra", 15, 0, 150);
       book(_h["part_phi"], "Particle_phi", 100, 0, 2*pi);
       book(_h["jet_phi"], "Jet_phi", 100, 0, 2*pi);
-      book(_h["jet_phi_00"], "Jet_phi_00", 100, 0, 2*pi);
-      book(_h["jet_phi_01"], "Jet_phi_01", 100, 0, 2*pi);
-      book(_h["jet_phi_02"], "Jet_phi_02", 100, 0, 2*pi);
-      book(_h["jet_phi_03"], "Jet_phi_03", 100, 0, 2*pi);
-      book(_h["jet_phi_04"], "Jet_phi_04", 100, 0, 2*pi);
-      book(_h["jet_phi_05"], "Jet_phi_05", 100, 0, 2*pi);
-      book(_h["jet_phi_06"], "Jet_phi_06", 100, 0, 2*pi);
-      book(_h["jet_phi_07"], "Jet_phi_07", 100, 0, 2*pi);
-      book(_h["jet_phi_08"], "Jet_phi_08", 100, 0, 2*pi);
-      book(_h["jet_phi_09"], "Jet_phi_09", 100, 0, 2*pi);
-      book(_h["jet_phi_10"], "Jet_phi_10", 100, 0, 2*pi);
-      book(_h["jet_phi_11"], "Jet_phi_11", 100, 0, 2*pi);
-      book(_h["jet_phi_12"], "Jet_phi_12", 100, 0, 2*pi);
-      book(_h["jet_phi_13"], "Jet_phi_13", 100, 0, 2*pi);
-      book(_h["jet_phi_14"], "Jet_phi_14", 100, 0, 2*pi);
       book(_h["part_eta"], "Particle_eta", 100, -3, 3);
       book(_h["jet_eta"], "Jet_eta", 100, -3, 3);
       book(_h["ep"], "Event_plane_angle", 100, -1*pi, pi);
@@ -75,12 +70,17 @@ namespace Rivet {
       //book(_h["ep3"], "Event_plane_angle_3", 360, 0, 2*pi);
       book(_h["part_in"], "In_plane_particles", 20, 0, 100);
       book(_h["part_out"], "Out_of_plane_particles", 20, 0, 100);
-      book(_h["jet_in"], "In_plane_jets", 15, 0, 150);
-      book(_h["jet_out"], "Out_of_plane_jets", 15, 0, 150);
+      // (jet pT, jet phi - Psi_2) yield, indexed by JetFlow
+      book(_h["jet_dphi"], "Jet_pT_dphi_EP", _jetFlow->GetNumBins(), 0, _jetFlow->GetNumBins());
+      _jetFlow->SetYieldHistogram(_h["jet_dphi"]);
+      book(_p["ep_res"], "Event_plane_subevent_correlation", 1, 0, 1);
+      _jetFlow->SetResolutionProfile(_p["ep_res"]);
 
       // Booking Scatters
       book(_h_jet_ratio, "Jet_ratio");
       book(_h_jet_v2, "Jet_v2");
+      book(_h_jet_v2_fourier, "Jet_v2_Fourier");
+      book(_h_jet_v2_corr, "Jet_v2_EPcorrected");
     }
 
 
@@ -96,14 +96,19 @@ namespace Rivet {
 
       // particles - calculating q vectors
       double Qx = 0, Qy = 0;
+      // sub-event q vectors (eta < 0, eta > 0) for the event-plane resolution
+      double QxA = 0, QyA = 0, QxB = 0, QyB = 0;
       int num_part = 0;
       const Particles& trks = apply<ChargedFinalState>(event, "tracks").particles();
       for (const Particle& p : trks) {
         _h["part_pt"]->fill(p.pT());
         _h["part_phi"]->fill(p.phi());
         _h["part_eta"]->fill(p.eta());
-        Qx += cos(2*p.phi());
-        Qy += sin(2*p.phi());
+        const double c2 = cos(2*p.phi()), s2 = sin(2*p.phi());
+        Qx += c2;
+        Qy += s2;
+        if (p.eta() < 0) { QxA += c2; QyA += s2; }
+        else { QxB += c2; QyB += s2; }
         num_part++;
       }
       _h["num_part"]->fill(num_part);
@@ -116,82 +121,23 @@ namespace Rivet {
           //ep_angle = 0.5*atan(Qy/Qx);
           ep_angle = mapAngle0ToPi(0.5*atan(Qy/Qx));
         }
+        _jetFlow->FillResolution(0.5*atan2(QyA, QxA), 0.5*atan2(QyB, QxB));
       }
       _h["ep"]->fill(ep_angle);
 
       // retrieve clustered jets, sorted by pT, with a minimum pT cut
       int num_jet = 0;
-      Jets jets = apply<FastJets>(event, "jets").jetsByPt(Cuts::pT > 10*GeV);
+      const JewelSubtraction& jewel = apply<JewelSubtraction>(event, "jewel");
+      Jets jets = jewel.subtract(apply<FastJets>(event, "jets").jetsByPt(), _jetR, Cuts::pT > 10*GeV);
       for(const Jet& j : jets) {
         Particles constituents = j.particles();
         if (constituents[0].pT() >= 3*GeV) {
           _h["jet_pt"]->fill(j.pT());
           _h["jet_phi"]->fill(j.phi());
           _h["jet_eta"]->fill(j.eta());
-          if (inRange(j.pT(), 0, 10)) _h["jet_phi_00"]->fill(j.phi());
-          if (inRange(j.pT(), 10, 20)) _h["jet_phi_01"]->fill(j.phi());
-          if (inRange(j.pT(), 20, 30)) _h["jet_phi_02"]->fill(j.phi());
-          if (inRange(j.pT(), 30, 40)) _h["jet_phi_03"]->fill(j.phi());
-          if (inRange(j.pT(), 40, 50)) _h["jet_phi_04"]->fill(j.phi());
-          if (inRange(j.pT(), 50, 60)) _h["jet_phi_05"]->fill(j.phi());
-          if (inRange(j.pT(), 60, 70)) _h["jet_phi_06"]->fill(j.phi());
-          if (inRange(j.pT(), 70, 80)) _h["jet_phi_07"]->fill(j.phi());
-          if (inRange(j.pT(), 80, 90)) _h["jet_phi_08"]->fill(j.phi());
-          if (inRange(j.pT(), 90, 100)) _h["jet_phi_09"]->fill(j.phi());
-          if (inRange(j.pT(), 100, 110)) _h["jet_phi_10"]->fill(j.phi());
-          if (inRange(j.pT(), 110, 120)) _h["jet_phi_11"]->fill(j.phi());
-          if (inRange(j.pT(), 120, 130)) _h["jet_phi_12"]->fill(j.phi());
-          if (inRange(j.pT(), 130, 140)) _h["jet_phi_13"]->fill(j.phi());
-          if (inRange(j.pT(), 140, 150)) _h["jet_phi_14"]->fill(j.phi());
-
-          if (!zero_ep) {
-            // counting in-plane vs out-of-plane jets
-            // 1st case if EP angle is between 0 and pi/4
-            if (inRange(ep_angle, 0, pi/4)) {
-              // angular ranges for in-plane jets
-              if (inRange(j.phi(), ep_angle - pi/4, ep_angle + pi/4) ||
-                  inRange(j.phi(), ep_angle + 3*pi/4, ep_angle + 5*pi/4) ||
-                  inRange(j.phi(), ep_angle + 7*pi/4, ep_angle + 9*pi/4)) {
-                _h["jet_in"]->fill(j.pT());
-                _h["jet_dif"]->fill(j.pT());
-              }
-              // angular ranges for out-of-plane jets
-              if (inRange(j.phi(), ep_angle + pi/4, ep_angle + 3*pi/4) ||
-                  inRange(j.phi(), ep_angle + 5*pi/4, ep_angle + 7*pi/4)) {
-                _h["jet_out"]->fill(j.pT());
-              }
-            }
-            // 2nd case if EP angle is > pi/4
-            if (inRange(ep_angle, pi/4, pi/2)) {
-              //angular ranges for in-plane jets
-              if (inRange(j.phi(), ep_angle - pi/4, ep_angle + pi/4) ||
-                  inRange(j.phi(), ep_angle + 3*pi/4, ep_angle + 5*pi/4) ||
-                  inRange(j.phi(), ep_angle + 7*pi/4, 2*pi)) {
-                _h["jet_in"]->fill(j.pT());
-              }
-              // angular ranges for out-of-plane jets
-              if (inRange(j.phi(), 0, ep_angle - pi/4) ||
-                  inRange(j.phi(), ep_angle + pi/4, ep_angle + 3*pi/4) ||
-                  inRange(j.phi(), ep_angle + 5*pi/4, ep_angle + 7*pi/4)) {
-                _h["jet_out"]->fill(j.pT());
-              }
-            }
-          }
-
-          if (zero_ep) {
-            // counting in-plane vs out-of-plane jets
-            // angular ranges for in-plane jets
-            if (inRange(j.phi(), 0, pi/4) ||
-                inRange(j.phi(), 3*pi/4, 5*pi/4) ||
-                inRange(j.phi(), 7*pi/4, 2*pi)) {
-              _h["jet_in"]->fill(j.pT());
-            }
-            // angular ranges for out-of-plane jets
-            if (inRange(j.phi(), pi/4, 3*pi/4) ||
-                inRange(j.phi(), 5*pi/4, 7*pi/4)) {
-              _h["jet_out"]->fill(j.pT());
-            }
-          }
+          // in/out-of-plane classification and v2 are derived from the
+          // (pT, phi - Psi_2) yield in finalize()
+          _jetFlow->Fill(j.pT(), j.phi(), ep_angle);
           // counting jets per event
           num_jet++;
         }
@@ -202,32 +148,16 @@ namespace Rivet {
 
     /// Normalise histograms etc., after the run
     void finalize() {
-      // calculating jet v2
-      int n_bins = _h["jet_in"]->numBins();
-      cout << "n_bins = " << n_bins << endl;
-      for (int i = 0; i < n_bins; i++) {
-        double n_in = 0, n_out = 0;
-        double jet_v2 = 0, ep_res = 1.0, jet_rat = 0.0;
-        cout << "Bin number " << i << endl;
-        n_in = _h["jet_in"]->bin(i).sumW();
-        n_out = _h["jet_out"]->bin(i).sumW();
-        cout << "n_in = " << n_in << "; n_out = " << n_out << endl;
-        if (n_out == 0) jet_rat = 0.0;
-        else jet_rat = (double) n_in / (double) n_out;
-        cout << "Jet ratio (n_in/n_out) = " << jet_rat << endl;
-        if (n_in + n_out == 0) jet_v2 = 0.0;
-        else jet_v2 = (pi/4)*(1/ep_res)*(n_in - n_out)/(n_in + n_out);
-        cout << "jet v_2 = " << jet_v2 << endl;
-      }
-
-      divide(_h["jet_in"], _h["jet_out"], _h_jet_ratio);
-      divide(*_h["jet_in"] - *_h["jet_out"], *_h["jet_in"] + *_h["jet_out"], _h_jet_v2);
-      _h_jet_v2->scale(1.0, pi/4.0);
+      _jetFlow->Finalize(_h_jet_ratio, _h_jet_v2, _h_jet_v2_fourier, _h_jet_v2_corr);
     }
 
   private:
     Scatter2DPtr _h_jet_ratio;
     Scatter2DPtr _h_jet_v2;
+    Scatter2DPtr _h_jet_v2_fourier;
+    Scatter2DPtr _h_jet_v2_corr;
+    shared_ptr<JetFlow> _jetFlow;
+    double _jetR;
 
     //@}
 
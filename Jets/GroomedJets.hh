@@ -0,0 +1,190 @@
+// -*- C++ -*-
+#ifndef RIVET_GROOMEDJETS_HH
+#define RIVET_GROOMEDJETS_HH
+
+#include "Rivet/Projection.hh"
+#include "Rivet/Projections/FastJets.hh"
+#include "Rivet/Projections/ParticleFinder.hh"
+#include "fastjet/ClusterSequence.hh"
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Cambridge-Aachen declustering of jets for SoftDrop and Lund-plane observables.
+///
+/// Every selected jet is reclustered with C/A once per event and its primary
+/// declustering chain (always following the harder branch) is stored as a
+/// flat array of splittings. Any number of SoftDrop settings and the
+/// primary Lund plane are then evaluated from that array without touching
+/// FastJet again.
+///
+/// The jets are taken from the wrapped FastJets projection. If a
+/// ParticleFinder is also given, the jets are reclustered from its
+/// particles first, as done with FastJets::calc() for the ALICE primary
+/// particles in the ALICE jet analyses.
+class GroomedJets: public Projection {
+
+public:
+
+  /// One step of the primary declustering chain.
+  struct Splitting {
+    /// pT fraction of the softer branch, pT2/(pT1 + pT2).
+    double z;
+    /// Rapidity-azimuth distance between the two branches.
+    double deltaR;
+    /// Relative transverse momentum of the softer branch, pT2 * deltaR.
+    double kt;
+    /// pT and mass of the (groomed) jet before this splitting.
+    double pt;
+    double m;
+  };
+
+  /// Result of SoftDrop grooming of one jet.
+  struct SoftDropResult {
+    /// False if no splitting passed the condition.
+    bool passed = false;
+    double zg = 0.;
+    double Rg = 0.;
+    double ptg = 0.;
+    double mg = 0.;
+    /// Number of splittings groomed away before the passing one.
+    int nGroomed = 0;
+  };
+
+  /// Constructor on the jets of @a fj passing @a c.
+  GroomedJets(const FastJets& fj, const Cut& c = Cuts::open())
+    : _jetCut(c), _recalc(false) {
+    setName("GroomedJets");
+    declare(fj, "Jets");
+  }
+
+  /// Constructor on the jets of @a fj reclustered from the particles of
+  /// @a inputs, passing @a c.
+  GroomedJets(const FastJets& fj, const ParticleFinder& inputs, const Cut& c = Cuts::open())
+    : _jetCut(c), _recalc(true) {
+    setName("GroomedJets");
+    declare(fj, "Jets");
+    declare(inputs, "Inputs");
+  }
+
+  DEFAULT_RIVET_PROJ_CLONE(GroomedJets);
+
+  /// The selected jets, sorted by pT.
+  const Jets& jets() const { return _jets; }
+
+  /// Number of primary splittings of jet @a ijet.
+  size_t numSplittings(size_t ijet) const { return _offset[ijet + 1] - _offset[ijet]; }
+
+  /// The @a k'th primary splitting of jet @a ijet, from wide to narrow angle.
+  const Splitting& splitting(size_t ijet, size_t k) const { return _splittings[_offset[ijet] + k]; }
+
+  /// Splittings of jet @a ijet as a [begin, end) range, e.g. for the Lund plane.
+  std::pair<const Splitting*, const Splitting*> splittings(size_t ijet) const {
+    const Splitting* first = _splittings.data() + _offset[ijet];
+    return std::make_pair(first, first + numSplittings(ijet));
+  }
+
+  /// SoftDrop with z > @a zcut (deltaR/@a R0)^@a beta on jet @a ijet.
+  SoftDropResult softDrop(size_t ijet, double zcut, double beta, double R0) const {
+    SoftDropResult res;
+    for(size_t k = _offset[ijet]; k < _offset[ijet + 1]; k++)
+    {
+      const Splitting& s = _splittings[k];
+      if(s.z > zcut*pow(s.deltaR/R0, beta))
+      {
+        res.passed = true;
+        res.zg = s.z;
+        res.Rg = s.deltaR;
+        res.ptg = s.pt;
+        res.mg = s.m;
+        return res;
+      }
+      res.nGroomed++;
+    }
+    // Groomed down to a single constituent
+    if(numSplittings(ijet) > 0)
+    {
+      const Splitting& last = _splittings[_offset[ijet + 1] - 1];
+      res.ptg = last.pt*(1. - last.z);
+    }
+    return res;
+  }
+
+  /// Rebuild the declustering trees from externally selected @a jets.
+  void calc(const Jets& jets) {
+    _jets = jets;
+    _splittings.clear();
+    _offset.assign(1, 0);
+    const fastjet::JetDefinition caDef(fastjet::cambridge_algorithm, fastjet::JetDefinition::max_allowable_R);
+    std::vector<fastjet::PseudoJet> constituents;
+    for(const Jet& jet : _jets)
+    {
+      constituents.clear();
+      // Rebuilt from the particles so that area ghosts are not declustered
+      for(const Particle& p : jet.particles()) constituents.push_back(p.pseudojet());
+      if(constituents.size() > 1)
+      {
+        fastjet::ClusterSequence cs(constituents, caDef);
+        const std::vector<fastjet::PseudoJet> caJets = cs.exclusive_jets(1);
+        fastjet::PseudoJet j = caJets[0];
+        fastjet::PseudoJet j1, j2;
+        while(j.has_parents(j1, j2))
+        {
+          if(j1.pt2() < j2.pt2()) std::swap(j1, j2);
+          const double dR = j1.delta_R(j2);
+          _splittings.push_back({j2.pt()/(j1.pt() + j2.pt()), dR, j2.pt()*dR, j.pt(), j.m()});
+          j = j1;
+        }
+      }
+      _offset.push_back(_splittings.size());
+    }
+  }
+
+protected:
+
+  void project(const Event& e) {
+    if(_recalc)
+    {
+      // Kept until the next event: the jets point into its ClusterSequence,
+      // which jet.pseudojet().area() needs
+      _reclustered = std::make_shared<FastJets>(apply<FastJets>(e, "Jets"));
+      _reclustered->calc(apply<ParticleFinder>(e, "Inputs").particles());
+      calc(_reclustered->jetsByPt(_jetCut));
+    }
+    else
+    {
+      calc(apply<FastJets>(e, "Jets").jetsByPt(_jetCut));
+    }
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection& p) const {
+    const GroomedJets& other = dynamic_cast<const GroomedJets&>(p);
+    if(_recalc != other._recalc) return CmpState::NEQ;
+    if(!(_jetCut == other._jetCut)) return CmpState::NEQ;
+    if(_recalc) return mkNamedPCmp(p, "Jets") || mkNamedPCmp(p, "Inputs");
+    return mkNamedPCmp(p, "Jets");
+  }
+
+private:
+
+  Cut _jetCut;
+  bool _recalc;
+
+  /// Jets of the current event.
+  Jets _jets;
+
+  /// Reclustered copy of the FastJets projection that owns the jets' ClusterSequence.
+  std::shared_ptr<FastJets> _reclustered;
+
+  /// Primary splittings of all jets; jet i owns [_offset[i], _offset[i+1]).
+  std::vector<Splitting> _splittings;
+  std::vector<size_t> _offset;
+
+};
+
+}
+
+#endif
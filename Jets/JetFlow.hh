@@ -0,0 +1,152 @@
+// -*- C++ -*-
+#ifndef RIVET_JETFLOW_HH
+#define RIVET_JETFLOW_HH
+
+#include "Rivet/Tools/RivetYODA.hh"
+#include "Rivet/Math/MathUtils.hh"
+#include <cmath>
+#include <vector>
+
+namespace Rivet {
+
+  /// @brief Jet yield vs (jet pT, jet phi - Psi_2) in one dense histogram.
+  ///
+  /// Both axes are uniform, so a jet goes straight to bin
+  /// iPt*nDPhi + iDPhi of a histogram booked with numBins() unit-width bins
+  /// over [0, numBins()). The histogram is booked by the analysis, so it is
+  /// weighted, written and merged like any other YODA object. In-plane /
+  /// out-of-plane ratios and v2 are extracted from it in Finalize().
+  class JetFlow {
+
+    private:
+      double _ptMin;
+      double _ptMax;
+      int _nPt;
+      int _nDPhi;
+      Histo1DPtr _yield;
+      Profile1DPtr _resolution;
+
+      /// Index into the dense histogram, -1 if the jet is outside the pT range.
+      int GetIndex(double jetPt, double dPhi) const
+      {
+              if(jetPt < _ptMin || jetPt >= _ptMax) return -1;
+              const int ipt = int((jetPt - _ptMin)*_nPt/(_ptMax - _ptMin));
+              const int idphi = std::min(int(dPhi*_nDPhi/M_PI), _nDPhi - 1);
+              return ipt*_nDPhi + idphi;
+      }
+
+    public:
+
+      /// Constructor: @a nPt uniform jet-pT bins in [@a ptMin, @a ptMax) and
+      /// @a nDPhi uniform bins of |phi - Psi_2| folded into [0, pi).
+      JetFlow(double ptMin, double ptMax, int nPt, int nDPhi = 16) :
+        _ptMin(ptMin), _ptMax(ptMax), _nPt(nPt), _nDPhi(nDPhi) { }
+
+      /// Number of bins the yield histogram must be booked with.
+      int GetNumBins() const { return _nPt*_nDPhi; }
+      int GetNumPtBins() const { return _nPt; }
+      int GetNumDPhiBins() const { return _nDPhi; }
+      double GetPtBinLow(int ipt) const { return _ptMin + ipt*(_ptMax - _ptMin)/_nPt; }
+      double GetPtBinHigh(int ipt) const { return GetPtBinLow(ipt + 1); }
+
+      void SetYieldHistogram(Histo1DPtr h){ _yield = h; }
+      void SetResolutionProfile(Profile1DPtr p){ _resolution = p; }
+
+      /// Add a jet at azimuth @a jetPhi for event-plane angle @a psi2.
+      void Fill(double jetPt, double jetPhi, double psi2)
+      {
+              const int index = GetIndex(jetPt, mapAngle0ToPi(jetPhi - psi2));
+              if(index >= 0) _yield->fill(index + 0.5);
+      }
+
+      /// Add cos(2(Psi_A - Psi_B)) of two equal-multiplicity sub-events.
+      void FillResolution(double psiA, double psiB)
+      {
+              if(_resolution) _resolution->fill(0.5, cos(2.*(psiA - psiB)));
+      }
+
+      /// Full-event Psi_2 resolution from the sub-event correlation, using
+      /// R_full = sqrt(2)*R_sub (valid for R_full below ~0.6). Returns 1 if no
+      /// sub-event correlation was recorded, e.g. for a fixed event plane.
+      double GetResolution() const
+      {
+              if(!_resolution || _resolution->bin(0).numEntries() == 0) return 1.;
+              const double mean = _resolution->bin(0).mean();
+              if(mean <= 0.) return 1.;
+              return std::min(1., sqrt(2.*mean));
+      }
+
+      /// Sum of weights (and squared weights) in/out of plane for pT bin @a ipt.
+      void GetInOut(int ipt, double& nIn, double& nOut, double& w2In, double& w2Out) const
+      {
+              nIn = nOut = w2In = w2Out = 0.;
+              for(int idphi = 0; idphi < _nDPhi; idphi++)
+              {
+                      const YODA::HistoBin1D& b = _yield->bin(ipt*_nDPhi + idphi);
+                      const double dPhi = (idphi + 0.5)*M_PI/_nDPhi;
+                      if(dPhi < M_PI/4. || dPhi > 3.*M_PI/4.) { nIn += b.sumW(); w2In += b.sumW2(); }
+                      else { nOut += b.sumW(); w2Out += b.sumW2(); }
+              }
+      }
+
+      /// <cos 2(phi - Psi_2)> for pT bin @a ipt, corrected for the finite
+      /// Delta phi bin width, and its statistical error.
+      pair<double,double> GetFourierV2(int ipt) const
+      {
+              const double width = M_PI/_nDPhi;
+              const double binCorr = sin(width)/width;
+              double sumW = 0., sumWCos = 0.;
+              for(int idphi = 0; idphi < _nDPhi; idphi++)
+              {
+                      const YODA::HistoBin1D& b = _yield->bin(ipt*_nDPhi + idphi);
+                      sumW += b.sumW();
+                      sumWCos += b.sumW()*cos(2.*(idphi + 0.5)*width);
+              }
+              if(sumW <= 0.) return make_pair(0., 0.);
+              const double v2 = sumWCos/sumW;
+              double var = 0.;
+              for(int idphi = 0; idphi < _nDPhi; idphi++)
+              {
+                      const double dev = cos(2.*(idphi + 0.5)*width) - v2;
+                      var += _yield->bin(ipt*_nDPhi + idphi).sumW2()*dev*dev;
+              }
+              return make_pair(v2/binCorr, sqrt(var)/(sumW*binCorr));
+      }
+
+      /// Fill the in/out ratio, the in/out v2 = pi/4 (N_in - N_out)/(N_in + N_out),
+      /// the Fourier v2 and the resolution-corrected Fourier v2 vs jet pT.
+      /// Null scatter pointers are skipped.
+      void Finalize(Scatter2DPtr ratio, Scatter2DPtr v2InOut, Scatter2DPtr v2Fourier, Scatter2DPtr v2Corrected)
+      {
+              const double res = GetResolution();
+              for(int ipt = 0; ipt < _nPt; ipt++)
+              {
+                      const double x = 0.5*(GetPtBinLow(ipt) + GetPtBinHigh(ipt));
+                      const double ex = 0.5*(GetPtBinHigh(ipt) - GetPtBinLow(ipt));
+
+                      double nIn, nOut, w2In, w2Out;
+                      GetInOut(ipt, nIn, nOut, w2In, w2Out);
+
+                      if(ratio && nIn > 0. && nOut > 0.)
+                      {
+                              const double r = nIn/nOut;
+                              ratio->addPoint(x, r, ex, r*sqrt(w2In/(nIn*nIn) + w2Out/(nOut*nOut)));
+                      }
+                      if(v2InOut && nIn + nOut > 0.)
+                      {
+                              const double sum = nIn + nOut;
+                              const double err = (M_PI/2.)*sqrt(nIn*nIn*w2Out + nOut*nOut*w2In)/(sum*sum);
+                              v2InOut->addPoint(x, (M_PI/4.)*(nIn - nOut)/sum, ex, err);
+                      }
+
+                      const pair<double,double> v2 = GetFourierV2(ipt);
+                      if(nIn + nOut <= 0.) continue;
+                      if(v2Fourier) v2Fourier->addPoint(x, v2.first, ex, v2.second);
+                      if(v2Corrected) v2Corrected->addPoint(x, v2.first/res, ex, v2.second/res);
+              }
+      }
+  };
+
+}
+
+#endif
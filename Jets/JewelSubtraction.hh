@@ -0,0 +1,183 @@
+// -*- C++ -*-
+#ifndef RIVET_JEWELSUBTRACTION_HH
+#define RIVET_JEWELSUBTRACTION_HH
+
+#include "Rivet/Projection.hh"
+#include "Rivet/Event.hh"
+#include "Rivet/Jet.hh"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Medium-response subtraction for JEWEL events with recoils.
+///
+/// With recoils switched on, JEWEL writes the thermal momenta of the
+/// scattering centres into the event record as status-3 entries, while the
+/// recoiling partons end up in the final state and are clustered as usual.
+/// This projection collects the scattering centres in one pass over the
+/// event record, so that already clustered jets can be corrected without
+/// reclustering, either
+///  - FOURMOM: by subtracting the summed four-momentum of the scattering
+///    centres within R of the jet axis from the jet four-momentum, or
+///  - GRID: by doing the same per eta-phi cell of the jet, dropping cells
+///    where the thermal pT exceeds the pT of the jet constituents.
+/// In OFF mode nothing is collected and jets are returned unchanged, so
+/// the same analysis code runs on PYTHIA or Angantyr samples.
+class JewelSubtraction: public Projection {
+
+public:
+
+  enum class Mode { OFF, FOURMOM, GRID };
+
+  /// Constructor. @a cellSize is the eta-phi cell width of the GRID mode.
+  JewelSubtraction(Mode mode, double cellSize = 0.1)
+    : _mode(mode), _cellSize(cellSize) {
+    setName("JewelSubtraction");
+  }
+
+  /// Constructor from an analysis option string: "OFF", "4MOM" or "GRID".
+  JewelSubtraction(const std::string& mode, double cellSize = 0.1)
+    : JewelSubtraction(modeFromString(mode), cellSize) { }
+
+  DEFAULT_RIVET_PROJ_CLONE(JewelSubtraction);
+
+  static Mode modeFromString(const std::string& mode) {
+    if(mode == "4MOM" || mode == "FOURMOM") return Mode::FOURMOM;
+    if(mode == "GRID") return Mode::GRID;
+    if(mode != "OFF") throw UserError("JewelSubtraction: unknown mode " + mode + ", use OFF, 4MOM or GRID");
+    return Mode::OFF;
+  }
+
+  Mode mode() const { return _mode; }
+
+  /// Number of thermal scattering centres (status 3) in the event.
+  size_t numThermal() const { return _thermal.size(); }
+
+  /// Number of final-state partons (recoils in parton-level JEWEL output).
+  size_t numRecoils() const { return _nRecoils; }
+
+  /// Subtracted four-momentum of @a jet with radius @a R.
+  FourMomentum subtracted(const Jet& jet, double R) const {
+    if(_mode == Mode::GRID) return subtractedGrid(jet, R);
+    if(_mode == Mode::OFF) return jet.momentum();
+    FourMomentum p = jet.momentum();
+    const double R2 = R*R;
+    for(size_t i = 0; i < _thermal.size(); i++)
+    {
+      if(dR2(i, jet.eta(), jet.phi()) < R2) p -= _thermal[i];
+    }
+    return p;
+  }
+
+  /// Subtracted copies of @a jets, re-sorted by pT and with @a c applied
+  /// after the subtraction. Constituents are kept for substructure.
+  Jets subtract(const Jets& jets, double R, const Cut& c = Cuts::open()) const {
+    if(_mode == Mode::OFF) return filter_select(jets, c);
+    Jets rtn;
+    rtn.reserve(jets.size());
+    for(const Jet& jet : jets)
+    {
+      Jet sub(subtracted(jet, R), jet.particles(), jet.tags());
+      if(c->accept(sub)) rtn.push_back(sub);
+    }
+    return sortByPt(rtn);
+  }
+
+protected:
+
+  /// Collect the scattering centres in one pass over the event record.
+  void project(const Event& e) {
+    _thermal.clear();
+    _eta.clear();
+    _phi.clear();
+    _nRecoils = 0;
+    if(_mode == Mode::OFF) return;
+
+    for(ConstGenParticlePtr gp : HepMCUtils::particles(e.genEvent()))
+    {
+      const int status = gp->status();
+      if(status == 3)
+      {
+        const FourMomentum p(gp->momentum());
+        if(p.pT() <= 0.) continue;
+        _thermal.push_back(p);
+        _eta.push_back(p.eta());
+        _phi.push_back(p.phi());
+      }
+      else if(status == 1)
+      {
+        const int apid = std::abs(gp->pdg_id());
+        if(apid <= 6 || apid == 21) _nRecoils++;
+      }
+    }
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection& p) const {
+    const JewelSubtraction& other = dynamic_cast<const JewelSubtraction&>(p);
+    return cmp(int(_mode), int(other._mode)) || cmp(_cellSize, other._cellSize);
+  }
+
+private:
+
+  double dR2(size_t i, double eta, double phi) const {
+    const double dEta = _eta[i] - eta;
+    const double dPhi = deltaPhi(_phi[i], phi);
+    return dEta*dEta + dPhi*dPhi;
+  }
+
+  long cellIndex(double eta, double phi) const {
+    const long ieta = long(std::floor(eta/_cellSize));
+    const long iphi = long(mapAngle0To2Pi(phi)/_cellSize);
+    return ieta*100000 + iphi;
+  }
+
+  /// Cell-wise subtraction: constituents and scattering centres are sorted
+  /// by cell and each cell contributes max(0, constituents - thermal).
+  FourMomentum subtractedGrid(const Jet& jet, double R) const {
+    struct Entry { long cell; int sign; FourMomentum p; };
+    std::vector<Entry> entries;
+    entries.reserve(jet.particles().size());
+    for(const Particle& p : jet.particles())
+      entries.push_back({cellIndex(p.eta(), p.phi()), +1, p.momentum()});
+    const double R2 = R*R;
+    for(size_t i = 0; i < _thermal.size(); i++)
+    {
+      if(dR2(i, jet.eta(), jet.phi()) < R2)
+        entries.push_back({cellIndex(_eta[i], _phi[i]), -1, _thermal[i]});
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.cell < b.cell; });
+
+    FourMomentum total;
+    size_t i = 0;
+    while(i < entries.size())
+    {
+      FourMomentum cellSum;
+      double ptJet = 0., ptThermal = 0.;
+      const long cell = entries[i].cell;
+      for(; i < entries.size() && entries[i].cell == cell; i++)
+      {
+        if(entries[i].sign > 0) { cellSum += entries[i].p; ptJet += entries[i].p.pT(); }
+        else { cellSum -= entries[i].p; ptThermal += entries[i].p.pT(); }
+      }
+      if(ptJet > ptThermal) total += cellSum;
+    }
+    return total;
+  }
+
+  Mode _mode;
+  double _cellSize;
+
+  /// Thermal scattering centres of the current event.
+  std::vector<FourMomentum> _thermal;
+  std::vector<double> _eta, _phi;
+  size_t _nRecoils = 0;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,188 @@
+// -*- C++ -*-
+#ifndef RIVET_PERPENDICULARCONEUE_HH
+#define RIVET_PERPENDICULARCONEUE_HH
+
+#include "Rivet/Projection.hh"
+#include "Rivet/Projections/ParticleFinder.hh"
+#include "Rivet/Jet.hh"
+#include "Rivet/Tools/RivetYODA.hh"
+#include <cmath>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Underlying-event estimate from cones perpendicular to a jet axis.
+///
+/// The particles of the wrapped ParticleFinder are sorted once per event
+/// into a regular eta-phi cell grid. Cone queries then only visit the cells
+/// overlapping the cone, so the same event can be queried for any number of
+/// jet axes and radii at the cost of the particles actually near the cones.
+class PerpendicularConeUE: public Projection {
+
+public:
+
+  /// The two cones at phi(jet) +- pi/2, as indices into particles().
+  struct Cones {
+    std::vector<size_t> plus;
+    std::vector<size_t> minus;
+    double radius = 0.;
+    double sumPt = 0.;
+
+    /// Number of particles in both cones.
+    size_t size() const { return plus.size() + minus.size(); }
+
+    /// pT density per unit area, averaged over the two cones.
+    double rho() const {
+      return radius > 0. ? sumPt/(2.*M_PI*radius*radius) : 0.;
+    }
+  };
+
+  /// Constructor. @a etaMax is the acceptance of @a fs and @a cellSize the
+  /// width of the eta-phi grid cells.
+  PerpendicularConeUE(const ParticleFinder& fs, double etaMax, double cellSize = 0.1)
+    : _etaMax(etaMax), _cellSize(cellSize) {
+    setName("PerpendicularConeUE");
+    _nEta = std::max(1, int(std::ceil(2.*_etaMax/_cellSize)));
+    _nPhi = std::max(1, int(std::floor(2.*M_PI/_cellSize)));
+    _phiCell = 2.*M_PI/_nPhi;
+    declare(fs, "FS");
+  }
+
+  DEFAULT_RIVET_PROJ_CLONE(PerpendicularConeUE);
+
+  /// The particles indexed by the cell grid.
+  const Particles& particles() const { return _particles; }
+
+  /// Indices of all particles within @a R of (@a eta, @a phi).
+  std::vector<size_t> coneIndices(double eta, double phi, double R) const {
+    std::vector<size_t> idx;
+    addCone(eta, phi, R, idx);
+    return idx;
+  }
+
+  /// The perpendicular cones of radius @a R around the axis of @a jet.
+  Cones cones(const Jet& jet, double R) const {
+    Cones c;
+    c.radius = R;
+    addCone(jet.eta(), mapAngle0To2Pi(jet.phi() + M_PI/2.), R, c.plus);
+    addCone(jet.eta(), mapAngle0To2Pi(jet.phi() - M_PI/2.), R, c.minus);
+    for(size_t i : c.plus) c.sumPt += _pt[i];
+    for(size_t i : c.minus) c.sumPt += _pt[i];
+    return c;
+  }
+
+  /// The perpendicular-cone pT density for @a jet with cone radius @a R.
+  double rho(const Jet& jet, double R) const {
+    return cones(jet, R).rho();
+  }
+
+  /// Fill the UE pT, z = pT/pT(jet) and xi = ln(pT(jet)/pT) spectra from
+  /// previously found cones. Null histogram pointers are skipped.
+  void fillUE(const Cones& c, const Jet& jet, Histo1DPtr hPt, Histo1DPtr hZ, Histo1DPtr hXi) const {
+    const double jetPt = jet.pT();
+    for(const std::vector<size_t>* cone : {&c.plus, &c.minus})
+    {
+      for(size_t i : *cone)
+      {
+        const double pt = _pt[i];
+        if(hPt) hPt->fill(pt/GeV);
+        if(hZ) hZ->fill(pt/jetPt);
+        if(hXi) hXi->fill(log(jetPt/pt));
+      }
+    }
+  }
+
+protected:
+
+  /// Sort the particles into the cell grid (counting sort, no per-cell vectors).
+  void project(const Event& e) {
+    _particles = apply<ParticleFinder>(e, "FS").particles();
+
+    const size_t n = _particles.size();
+    _pt.resize(n);
+    _eta.resize(n);
+    _phi.resize(n);
+    std::vector<int> cell(n);
+
+    _cellStart.assign(_nEta*_nPhi + 1, 0);
+    for(size_t i = 0; i < n; i++)
+    {
+      const Particle& p = _particles[i];
+      _pt[i] = p.pT();
+      _eta[i] = p.eta();
+      _phi[i] = p.phi();
+      cell[i] = etaCell(_eta[i])*_nPhi + phiCell(_phi[i]);
+      _cellStart[cell[i] + 1]++;
+    }
+    for(size_t ic = 0; ic < _cellStart.size() - 1; ic++) _cellStart[ic + 1] += _cellStart[ic];
+
+    _cellContent.resize(n);
+    std::vector<size_t> fill(_cellStart.begin(), _cellStart.end() - 1);
+    for(size_t i = 0; i < n; i++) _cellContent[fill[cell[i]]++] = i;
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection& p) const {
+    const PerpendicularConeUE& other = dynamic_cast<const PerpendicularConeUE&>(p);
+    return mkNamedPCmp(p, "FS") || cmp(_etaMax, other._etaMax) || cmp(_cellSize, other._cellSize);
+  }
+
+private:
+
+  int etaCell(double eta) const {
+    const int ie = int((eta + _etaMax)/_cellSize);
+    return std::min(std::max(ie, 0), _nEta - 1);
+  }
+
+  int phiCell(double phi) const {
+    return std::min(int(mapAngle0To2Pi(phi)/_phiCell), _nPhi - 1);
+  }
+
+  /// Append the indices of the particles within @a R of (@a eta, @a phi).
+  void addCone(double eta, double phi, double R, std::vector<size_t>& idx) const {
+    if(_particles.empty()) return;
+    const double R2 = R*R;
+    const int ieMin = etaCell(eta - R);
+    const int ieMax = etaCell(eta + R);
+    // Visit each phi column at most once, even when the cone wraps around
+    const int nDPhi = std::min(_nPhi, int(std::ceil(R/_phiCell)) + 1);
+    const int ipCentre = phiCell(phi);
+    const int ipFirst = ipCentre - nDPhi;
+    const int ipLast = std::min(ipCentre + nDPhi, ipFirst + _nPhi - 1);
+
+    for(int ie = ieMin; ie <= ieMax; ie++)
+    {
+      for(int ipRaw = ipFirst; ipRaw <= ipLast; ipRaw++)
+      {
+        const int ip = ((ipRaw % _nPhi) + _nPhi) % _nPhi;
+        const int ic = ie*_nPhi + ip;
+        for(size_t k = _cellStart[ic]; k < _cellStart[ic + 1]; k++)
+        {
+          const size_t i = _cellContent[k];
+          const double dEta = _eta[i] - eta;
+          const double dPhi = deltaPhi(_phi[i], phi);
+          if(dEta*dEta + dPhi*dPhi <= R2) idx.push_back(i);
+        }
+      }
+    }
+  }
+
+  double _etaMax;
+  double _cellSize;
+  int _nEta;
+  int _nPhi;
+  double _phiCell;
+
+  /// Particles of the current event and their kinematics as flat arrays.
+  Particles _particles;
+  std::vector<double> _pt, _eta, _phi;
+
+  /// Cell grid: particles of cell ic are _cellContent[_cellStart[ic] .. _cellStart[ic+1]).
+  std::vector<size_t> _cellStart;
+  std::vector<size_t> _cellContent;
+
+};
+
+}
+
+#endif
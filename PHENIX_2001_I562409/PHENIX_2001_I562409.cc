@@ -6,6 +6,7 @@
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 #include "Rivet/Projections/UnstableParticles.hh"
 #include "Rivet/Projections/HadronicFinalState.hh"
 
@@ -65,7 +66,7 @@ namespace Rivet {
       
       // Initialise and register projections
       if (collSys != pp){
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
       }
       // The basic final-state projection:
       // all final-state particles within
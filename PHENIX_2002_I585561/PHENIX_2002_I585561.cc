@@ -6,6 +6,7 @@
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/DirectFinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 namespace Rivet {
 
@@ -28,7 +29,7 @@ namespace Rivet {
 
         
       //Projection for centrality determination
-      declareCentrality(RHICCentrality("PHENIX"),"RHIC_2019_CentralityCallibration:exp=PHENIX","CMULT","CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCallibration:exp=PHENIX", "CMULT");
       // The basic final-state projection:
       // all final-state particles within
       // the given eta acceptance
@@ -12,6 +12,7 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh" //external header for Centrality calculation
+#include "../Centralities/CentralityTable.hh"
 #include <math.h>
 #include <fstream>
 #include <iostream>
@@ -95,7 +96,7 @@ public:
         
         // Declare centrality projection for centrality estimation
         //if (!(collSys == pp))
-        declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX","CMULT","CMULT");
+        DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
         
         
         //Ratio of protons/pions
@@ -2,6 +2,7 @@
 #include "Rivet/Analysis.hh"
 #include "Rivet/Projections/FinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 namespace Rivet {
 
@@ -30,7 +31,7 @@ namespace Rivet {
       // The final-state particles declared above are clustered using FastJet with
       // the anti-kT algorithm and a jet-radius parameter 0.4
       // muons and neutrinos are excluded from the clustering
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
       book(_h["KaonPlusMinBias"], 1, 1, 1);
       book(_h["KaonMinusMinBias"], 1, 1, 2);
       book(_h["PionPlusMinBias"], 2, 1, 1);
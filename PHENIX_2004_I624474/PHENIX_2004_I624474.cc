@@ -7,6 +7,9 @@
 #include "Rivet/Projections/PrimaryParticles.hh"
 #include "Rivet/Projections/UnstableParticles.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/HistoBank.hh"
+#include "../Spectra/IdentifiedParticles.hh"
 #include <math.h>
 #include <iostream>
 #define _USE_MATH_DEFINES
@@ -45,6 +48,12 @@ namespace Rivet {
             }
         }
     }
+	/// The histogram booked under @a key, or a null handle; unlike
+	/// operator[] this does not add an entry to the map.
+	static Histo1DPtr booked(const map<string, Histo1DPtr>& histos, const string& key) {
+		auto found = histos.find(key);
+		return found == histos.end() ? Histo1DPtr() : found->second;
+	}
 	/// Book histograms and initialise projections before the run
 	void init() {
 	
@@ -53,12 +62,12 @@ namespace Rivet {
 	std::initializer_list<int> pdgIds ={211, 321, 2212, -211, -321, -2212};
 
 	const PrimaryParticles cp(pdgIds, Cuts::abseta < .35 && Cuts::abscharge > 0);
-	declare(cp, "cp");
+	declare(IdentifiedParticles(cp, pdgIds), "cp");
 
 	const UnstableParticles np(Cuts::abseta < .35 && Cuts::abspid == 111);
 	declare(np, "np");
 
-	declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+	DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
 	// Book histograms
 	
@@ -66,253 +75,253 @@ namespace Rivet {
 	//___PiPlus yields___
 
 	//Invariant yield of piplus minimum bias
-	book(hAUAU_Yields["Piplusmin"],1,1,1);
+	book(hAUAU_Yields(PIPLUS, CMIN),1,1,1);
 
 	//Invariant yield of piplus 0-5%
-	book(hAUAU_Yields["Piplus5"],1,1,2);
+	book(hAUAU_Yields(PIPLUS, C0_5),1,1,2);
 
 	//Invariant yield of piplus 5-10%
-	book(hAUAU_Yields["Piplus10"],1,1,3);
+	book(hAUAU_Yields(PIPLUS, C5_10),1,1,3);
 
 	//Invariant yield of piplus 10-15% 
-	book(hAUAU_Yields["Piplus15"],1,1,4);
+	book(hAUAU_Yields(PIPLUS, C10_15),1,1,4);
 
 	//Invariant yield of piplus 15-20%
-	book(hAUAU_Yields["Piplus20"],1,1,5);
+	book(hAUAU_Yields(PIPLUS, C15_20),1,1,5);
 
 	//Invariant yield of piplus 20-30%
-	book(hAUAU_Yields["Piplus30"],1,1,6);
+	book(hAUAU_Yields(PIPLUS, C20_30),1,1,6);
 
 	//Invariant yield of piplus 30-40%
-	book(hAUAU_Yields["Piplus40"],1,1,7);
+	book(hAUAU_Yields(PIPLUS, C30_40),1,1,7);
 
 	//Invariant yield of piplus 40-50%
-	book(hAUAU_Yields["Piplus50"],1,1,8);
+	book(hAUAU_Yields(PIPLUS, C40_50),1,1,8);
 
 	//Invariant yield of piplus 50-60%
-	book(hAUAU_Yields["Piplus60"],1,1,9);
+	book(hAUAU_Yields(PIPLUS, C50_60),1,1,9);
 
 	//Invariant yield of piplus 60-70%
-	book(hAUAU_Yields["Piplus70"],1,1,10);
+	book(hAUAU_Yields(PIPLUS, C60_70),1,1,10);
 
 	//Invariant yield of piplus 70-80%
-	book(hAUAU_Yields["Piplus80"],1,1,11);
+	book(hAUAU_Yields(PIPLUS, C70_80),1,1,11);
 
 	//Invariant yield of piplus 80-92%
-	book(hAUAU_Yields["Piplus92"],1,1,12);
+	book(hAUAU_Yields(PIPLUS, C80_92),1,1,12);
 
 	//Invariant yield of piplus 60-92%
-	book(hAUAU_Yields["Piplus60_92"],1,1,13);
+	book(hAUAU_Yields(PIPLUS, C60_92),1,1,13);
 
 
 	//___PiMinus yields___
 
 	//Invariant yield of piminus minimum bias
-	book(hAUAU_Yields["Piminusmin"],2,1,1);
+	book(hAUAU_Yields(PIMINUS, CMIN),2,1,1);
 
 	//Invariant yield of piminus 0-5%
-	book(hAUAU_Yields["Piminus5"],2,1,2);
+	book(hAUAU_Yields(PIMINUS, C0_5),2,1,2);
 
 	//Invariant yield of piminus 5-10%
-	book(hAUAU_Yields["Piminus10"],2,1,3);
+	book(hAUAU_Yields(PIMINUS, C5_10),2,1,3);
 
 	//Invariant yield of piminus 10-15% 
-	book(hAUAU_Yields["Piminus15"],2,1,4);
+	book(hAUAU_Yields(PIMINUS, C10_15),2,1,4);
 
 	//Invariant yield of piminus 15-20%
-	book(hAUAU_Yields["Piminus20"],2,1,5);
+	book(hAUAU_Yields(PIMINUS, C15_20),2,1,5);
 
 	//Invariant yield of piminus 20-30%
-	book(hAUAU_Yields["Piminus30"],2,1,6);
+	book(hAUAU_Yields(PIMINUS, C20_30),2,1,6);
 
 	//Invariant yield of piminus 30-40%
-	book(hAUAU_Yields["Piminus40"],2,1,7);
+	book(hAUAU_Yields(PIMINUS, C30_40),2,1,7);
 
 	//Invariant yield of piminus 40-50%
-	book(hAUAU_Yields["Piminus50"],2,1,8);
+	book(hAUAU_Yields(PIMINUS, C40_50),2,1,8);
 
 	//Invariant yield of piminus 50-60%
-	book(hAUAU_Yields["Piminus60"],2,1,9);
+	book(hAUAU_Yields(PIMINUS, C50_60),2,1,9);
 
 	//Invariant yield of piminus 60-70%
-	book(hAUAU_Yields["Piminus70"],2,1,10);
+	book(hAUAU_Yields(PIMINUS, C60_70),2,1,10);
 
 	//Invariant yield of piminus 70-80%
-	book(hAUAU_Yields["Piminus80"],2,1,11);
+	book(hAUAU_Yields(PIMINUS, C70_80),2,1,11);
 
 	//Invariant yield of piminus 80-92%
-	book(hAUAU_Yields["Piminus92"],2,1,12);
+	book(hAUAU_Yields(PIMINUS, C80_92),2,1,12);
 
 	//Invariant yield of piminus 60-92%
-	book(hAUAU_Yields["Piminus60_92"],2,1,13);
+	book(hAUAU_Yields(PIMINUS, C60_92),2,1,13);
 
 
 	//___KPlus yields___
 
 	//Invariant yield of Kplus minimum bias
-	book(hAUAU_Yields["Kplusmin"],3,1,1);
+	book(hAUAU_Yields(KPLUS, CMIN),3,1,1);
 
 	//Invariant yield of Kplus 0-5%
-	book(hAUAU_Yields["Kplus5"],3,1,2);
+	book(hAUAU_Yields(KPLUS, C0_5),3,1,2);
 
 	//Invariant yield of Kplus 5-10%
-	book(hAUAU_Yields["Kplus10"],3,1,3);
+	book(hAUAU_Yields(KPLUS, C5_10),3,1,3);
 
 	//Invariant yield of Kplus 10-15% 
-	book(hAUAU_Yields["Kplus15"],3,1,4);
+	book(hAUAU_Yields(KPLUS, C10_15),3,1,4);
 
 	//Invariant yield of Kplus 15-20%
-	book(hAUAU_Yields["Kplus20"],3,1,5);
+	book(hAUAU_Yields(KPLUS, C15_20),3,1,5);
 
 	//Invariant yield of Kplus 20-30%
-	book(hAUAU_Yields["Kplus30"],3,1,6);
+	book(hAUAU_Yields(KPLUS, C20_30),3,1,6);
 
 	//Invariant yield of Kplus 30-40%
-	book(hAUAU_Yields["Kplus40"],3,1,7);
+	book(hAUAU_Yields(KPLUS, C30_40),3,1,7);
 
 	//Invariant yield of Kplus 40-50%
-	book(hAUAU_Yields["Kplus50"],3,1,8);
+	book(hAUAU_Yields(KPLUS, C40_50),3,1,8);
 
 	//Invariant yield of Kplus 50-60%
-	book(hAUAU_Yields["Kplus60"],3,1,9);
+	book(hAUAU_Yields(KPLUS, C50_60),3,1,9);
 
 	//Invariant yield of Kplus 60-70%
-	book(hAUAU_Yields["Kplus70"],3,1,10);
+	book(hAUAU_Yields(KPLUS, C60_70),3,1,10);
 
 	//Invariant yield of Kplus 70-80%
-	book(hAUAU_Yields["Kplus80"],3,1,11);
+	book(hAUAU_Yields(KPLUS, C70_80),3,1,11);
 
 	//Invariant yield of Kplus 80-92%
-	book(hAUAU_Yields["Kplus92"],3,1,12);
+	book(hAUAU_Yields(KPLUS, C80_92),3,1,12);
 
 	//Invariant yield of Kplus 60-92%
-	book(hAUAU_Yields["Kplus60_92"],3,1,13);
+	book(hAUAU_Yields(KPLUS, C60_92),3,1,13);
 
 
 	//___KMinus yields___
 
 	//Invariant yield of Kminus minimum bias
-	book(hAUAU_Yields["Kminusmin"],4,1,1);
+	book(hAUAU_Yields(KMINUS, CMIN),4,1,1);
 
 	//Invariant yield of Kminus 0-5%
-	book(hAUAU_Yields["Kminus5"],4,1,2);
+	book(hAUAU_Yields(KMINUS, C0_5),4,1,2);
 
 	//Invariant yield of Kminus 5-10%
-	book(hAUAU_Yields["Kminus10"],4,1,3);
+	book(hAUAU_Yields(KMINUS, C5_10),4,1,3);
 
 	//Invariant yield of Kminus 10-15% 
-	book(hAUAU_Yields["Kminus15"],4,1,4);
+	book(hAUAU_Yields(KMINUS, C10_15),4,1,4);
 
 	//Invariant yield of Kminus 15-20%
-	book(hAUAU_Yields["Kminus20"],4,1,5);
+	book(hAUAU_Yields(KMINUS, C15_20),4,1,5);
 
 	//Invariant yield of Kminus 20-30%
-	book(hAUAU_Yields["Kminus30"],4,1,6);
+	book(hAUAU_Yields(KMINUS, C20_30),4,1,6);
 
 	//Invariant yield of Kminus 30-40%
-	book(hAUAU_Yields["Kminus40"],4,1,7);
+	book(hAUAU_Yields(KMINUS, C30_40),4,1,7);
 
 	//Invariant yield of Kminus 40-50%
-	book(hAUAU_Yields["Kminus50"],4,1,8);
+	book(hAUAU_Yields(KMINUS, C40_50),4,1,8);
 
 	//Invariant yield of Kminus 50-60%
-	book(hAUAU_Yields["Kminus60"],4,1,9);
+	book(hAUAU_Yields(KMINUS, C50_60),4,1,9);
 
 	//Invariant yield of Kminus 60-70%
-	book(hAUAU_Yields["Kminus70"],4,1,10);
+	book(hAUAU_Yields(KMINUS, C60_70),4,1,10);
 
 	//Invariant yield of Kminus 70-80%
-	book(hAUAU_Yields["Kminus80"],4,1,11);
+	book(hAUAU_Yields(KMINUS, C70_80),4,1,11);
 
 	//Invariant yield of Kminus 80-92%
-	book(hAUAU_Yields["Kminus92"],4,1,12);
+	book(hAUAU_Yields(KMINUS, C80_92),4,1,12);
 
 	//Invariant yield of Kminus 60-92%
-	book(hAUAU_Yields["Kminus60_92"],4,1,13);
+	book(hAUAU_Yields(KMINUS, C60_92),4,1,13);
 
 
 	//___Proton yields___
 
 	//Invariant yield of protons minimum bias
-	book(hAUAU_Yields["Protonsmin"],5,1,1);
+	book(hAUAU_Yields(PROTON, CMIN),5,1,1);
 
 	//Invariant yield of protons 0-5%
-	book(hAUAU_Yields["Protons5"],5,1,2);
+	book(hAUAU_Yields(PROTON, C0_5),5,1,2);
 
 	//Invariant yield of protons 5-10%
-	book(hAUAU_Yields["Protons10"],5,1,3);
+	book(hAUAU_Yields(PROTON, C5_10),5,1,3);
 
 	//Invariant yield of protons 10-15% 
-	book(hAUAU_Yields["Protons15"],5,1,4);
+	book(hAUAU_Yields(PROTON, C10_15),5,1,4);
 
 	//Invariant yield of protons 15-20%
-	book(hAUAU_Yields["Protons20"],5,1,5);
+	book(hAUAU_Yields(PROTON, C15_20),5,1,5);
 
 	//Invariant yield of protons 20-30%
-	book(hAUAU_Yields["Protons30"],5,1,6);
+	book(hAUAU_Yields(PROTON, C20_30),5,1,6);
 
 	//Invariant yield of protons 30-40%
-	book(hAUAU_Yields["Protons40"],5,1,7);
+	book(hAUAU_Yields(PROTON, C30_40),5,1,7);
 
 	//Invariant yield of protons 40-50%
-	book(hAUAU_Yields["Protons50"],5,1,8);
+	book(hAUAU_Yields(PROTON, C40_50),5,1,8);
 
 	//Invariant yield of protons 50-60%
-	book(hAUAU_Yields["Protons60"],5,1,9);
+	book(hAUAU_Yields(PROTON, C50_60),5,1,9);
 
 	//Invariant yield of protons 60-70%
-	book(hAUAU_Yields["Protons70"],5,1,10);
+	book(hAUAU_Yields(PROTON, C60_70),5,1,10);
 
 	//Invariant yield of protons 70-80%
-	book(hAUAU_Yields["Protons80"],5,1,11);
+	book(hAUAU_Yields(PROTON, C70_80),5,1,11);
 
 	//Invariant yield of protons 80-92%
-	book(hAUAU_Yields["Protons92"],5,1,12);
+	book(hAUAU_Yields(PROTON, C80_92),5,1,12);
 
 	//Invariant yield of protons 60-92%
-	book(hAUAU_Yields["Protons60_92"],5,1,13);
+	book(hAUAU_Yields(PROTON, C60_92),5,1,13);
 
 
 	//___Pbar yields___
 
 	//Invariant yield of pbar minimum bias
-	book(hAUAU_Yields["Pbarmin"],6,1,1);
+	book(hAUAU_Yields(PBAR, CMIN),6,1,1);
 
 	//Invariant yield of pbar 0-5%
-	book(hAUAU_Yields["Pbar5"],6,1,2);
+	book(hAUAU_Yields(PBAR, C0_5),6,1,2);
 
 	//Invariant yield of pbar 5-10%
-	book(hAUAU_Yields["Pbar10"],6,1,3);
+	book(hAUAU_Yields(PBAR, C5_10),6,1,3);
 
 	//Invariant yield of pbar 10-15% 
-	book(hAUAU_Yields["Pbar15"],6,1,4);
+	book(hAUAU_Yields(PBAR, C10_15),6,1,4);
 
 	//Invariant yield of pbar 15-20%
-	book(hAUAU_Yields["Pbar20"],6,1,5);
+	book(hAUAU_Yields(PBAR, C15_20),6,1,5);
 
 	//Invariant yield of pbar 20-30%
-	book(hAUAU_Yields["Pbar30"],6,1,6);
+	book(hAUAU_Yields(PBAR, C20_30),6,1,6);
 
 	//Invariant yield of pbar 30-40%
-	book(hAUAU_Yields["Pbar40"],6,1,7);
+	book(hAUAU_Yields(PBAR, C30_40),6,1,7);
 
 	//Invariant yield of pbar 40-50%
-	book(hAUAU_Yields["Pbar50"],6,1,8);
+	book(hAUAU_Yields(PBAR, C40_50),6,1,8);
 
 	//Invariant yield of pbar 50-60%
-	book(hAUAU_Yields["Pbar60"],6,1,9);
+	book(hAUAU_Yields(PBAR, C50_60),6,1,9);
 
 	//Invariant yield of pbar 60-70%
-	book(hAUAU_Yields["Pbar70"],6,1,10);
+	book(hAUAU_Yields(PBAR, C60_70),6,1,10);
 
 	//Invariant yield of pbar 70-80%
-	book(hAUAU_Yields["Pbar80"],6,1,11);
+	book(hAUAU_Yields(PBAR, C70_80),6,1,11);
 
 	//Invariant yield of pbar 80-92%
-	book(hAUAU_Yields["Pbar92"],7,1,1);
+	book(hAUAU_Yields(PBAR, C80_92),7,1,1);
 
 	//Invariant yield of pbar 60-92%
-	book(hAUAU_Yields["Pbar60_92"],6,1,12);
+	book(hAUAU_Yields(PBAR, C60_92),6,1,12);
 
 
 
@@ -585,22 +594,39 @@ namespace Rivet {
 	book(hPPi["AUAUPiminus"], refnamePbarPiminus + "Pi", refdataPbarPiminus);
 	book(hRatio["PbarPiminus"], refnamePbarPiminus);
 
+	// Resolve the handles filled per particle in analyze() once here, so
+	// that the particle loop does no string lookups
+	const vector<string> ratioClasses = {"min", "0_5", "0_10", "20_30", "60_92", ""};
+	const vector<string> ratioTerms = {"Piplus", "Piminus", "Kplus", "Kminus", "P", "Pbar", "PPi0", "PbarPi0", "PbarPiminus", "ProtonPiplus"};
+	const vector<string> speciesNames = {"Piplus", "Piminus", "Kplus", "Kminus", "Protons", "Pbar"};
+	for (size_t s = 0; s < NSPECIES; ++s) pMeanPtBank(s, 0) = pmeanPt[speciesNames[s]];
+	for (size_t r = 0; r < NRATIOCLASS; ++r) {
+		const string prefix = "AUAU" + ratioClasses[r];
+		for (size_t t = 0; t < NRATIOTERM; ++t) {
+			hPiPiBank(t, r) = booked(hPiPi, prefix + ratioTerms[t]);
+			hKPiBank(t, r) = booked(hKPi, prefix + ratioTerms[t]);
+			hPPiBank(t, r) = booked(hPPi, prefix + ratioTerms[t]);
+			hKKBank(t, r) = booked(hKK, prefix + ratioTerms[t]);
+			hPPBank(t, r) = booked(hPP, prefix + ratioTerms[t]);
+		}
+		for (size_t k = 0; k < NRCPCUT; ++k) {
+			const string key = prefix + (k == RCP1_5 ? "GeV1_5" : "");
+			hPiRcp(k, r) = booked(hPi, key);
+			hKRcp(k, r) = booked(hK, key);
+			hPRcp(k, r) = booked(hP, key);
+			hPi0Rcp(k, r) = booked(hPi0, key);
+		}
+	}
 	}
 
 	void analyze(const Event& event) {
 
-		const PrimaryParticles cp = apply<PrimaryParticles>(event, "cp");
-		const UnstableParticles np = apply<UnstableParticles>(event, "np");
+		const IdentifiedParticles& cp = apply<IdentifiedParticles>(event, "cp");
+		const UnstableParticles& np = apply<UnstableParticles>(event, "np");
 		const CentralityProjection& cent = apply<CentralityProjection>(event, "CMULT");
 		const double c = cent();
-		const Particles chargedParticles = cp.particles();
-		const Particles neutralParticles = np.particles();
-		const Particles Piplus = cp.particles(Cuts::pid == 211);
-		const Particles Piminus = cp.particles(Cuts::pid == -211);
-		const Particles Kplus = cp.particles(Cuts::pid == 321);
-		const Particles Kminus = cp.particles(Cuts::pid == -321);
-		const Particles Protons = cp.particles(Cuts::pid == 2212);
-		const Particles Pbar = cp.particles(Cuts::pid == -2212);
+		const Particles& chargedParticles = cp.particles();
+		const Particles& neutralParticles = np.particles();
 
 		const ParticlePair& beam = beams();
 	
@@ -612,12 +638,12 @@ namespace Rivet {
     	if (beam.first.pid() == 1000791970 && beam.second.pid() == 1000791970) collSys = AuAu200;
 		}
 
-		pdN_dy["Piplus"]->fill(c, Piplus.size());
-		pdN_dy["Piminus"]->fill(c, Piminus.size());
-		pdN_dy["Kplus"]->fill(c, Kplus.size());
-		pdN_dy["Kminus"]->fill(c, Kminus.size());
-		pdN_dy["Protons"]->fill(c, Protons.size());
-		pdN_dy["Pbar"]->fill(c, Pbar.size());
+		pdN_dy["Piplus"]->fill(c, cp.size(211));
+		pdN_dy["Piminus"]->fill(c, cp.size(-211));
+		pdN_dy["Kplus"]->fill(c, cp.size(321));
+		pdN_dy["Kminus"]->fill(c, cp.size(-321));
+		pdN_dy["Protons"]->fill(c, cp.size(2212));
+		pdN_dy["Pbar"]->fill(c, cp.size(-2212));
 
 		if ((c < 0.) || (c > 92.2)) vetoEvent;
 
@@ -639,87 +665,87 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus5"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPi["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for Pi
-						hPiPi["AUAU0_5Piplus"]->fill(partPt);	//ratio denominator for Pi-/Pi+ 0-5%
-						hKPi["AUAU0_5Piplus"]->fill(partPt);	//ratio denominator for K+/Pi+ 0-5%
-						hPPi["AUAU0_10Piplus"]->fill(partPt);	//ratio denominator for P/Pi+ 0-10%
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+ vs c
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C0_5)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pi
+						hPiPiBank(TPIPLUS, R0_5)->fill(partPt);	//ratio denominator for Pi-/Pi+ 0-5%
+						hKPiBank(TPIPLUS, R0_5)->fill(partPt);	//ratio denominator for K+/Pi+ 0-5%
+						hPPiBank(TPIPLUS, R0_10)->fill(partPt);	//ratio denominator for P/Pi+ 0-10%
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+ vs c
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus5"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPi["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for Pi
-						hPiPi["AUAU0_5Piminus"]->fill(partPt);	//ratio numerator for Pi-/Pi+ 0-5%
-						hKPi["AUAU0_5Piminus"]->fill(partPt);	//ratio denominator for K-/Pi- 0-5%
-						hPPi["AUAU0_10Piminus"]->fill(partPt);	//ratio denominator for Pbar/Pi- 0-10%
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C0_5)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pi
+						hPiPiBank(TPIMINUS, R0_5)->fill(partPt);	//ratio numerator for Pi-/Pi+ 0-5%
+						hKPiBank(TPIMINUS, R0_5)->fill(partPt);	//ratio denominator for K-/Pi- 0-5%
+						hPPiBank(TPIMINUS, R0_10)->fill(partPt);	//ratio denominator for Pbar/Pi- 0-10%
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus5"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hK["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for K
-						hKK["AUAU0_5Kplus"]->fill(partPt);	//ratio denominator for K-/K+ 0-5%
-						hKPi["AUAU0_5Kplus"]->fill(partPt);	//ratio numerator for K+/Pi+ 0-5%
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C0_5)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for K
+						hKKBank(TKPLUS, R0_5)->fill(partPt);	//ratio denominator for K-/K+ 0-5%
+						hKPiBank(TKPLUS, R0_5)->fill(partPt);	//ratio numerator for K+/Pi+ 0-5%
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus5"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hK["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for K
-						hKK["AUAU0_5Kplus"]->fill(partPt);	//ratio numerator for K-/K+ 0-5%
-						hKPi["AUAU0_5Kminus"]->fill(partPt);	//ratio numerator for K-/Pi- 0-5%
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C0_5)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for K
+						hKKBank(TKPLUS, R0_5)->fill(partPt);	//ratio numerator for K-/K+ 0-5%
+						hKPiBank(TKMINUS, R0_5)->fill(partPt);	//ratio numerator for K-/Pi- 0-5%
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons5"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hP["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for P+Pbar
-						hPP["AUAU0_5P"]->fill(partPt);		//ratio denominator for Pbar/P 0-5%
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPPi["AUAU0_10ProtonPiplus"]->fill(partPt);	//ratio numerator for P/Pi+ 0-10%
-						hPPi["AUAU0_10P"]->fill(partPt);	//ratio numerator for P/Pi0 0-10%
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C0_5)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for P+Pbar
+						hPPBank(TP, R0_5)->fill(partPt);		//ratio denominator for Pbar/P 0-5%
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPiBank(TPROTONPIPLUS, R0_10)->fill(partPt);	//ratio numerator for P/Pi+ 0-10%
+						hPPiBank(TP, R0_10)->fill(partPt);	//ratio numerator for P/Pi0 0-10%
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar5"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hP["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for P+Pbar
-						hPP["AUAU0_5Pbar"]->fill(partPt);	//ratio numerator for Pbar/P 0-5%
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPPi["AUAU0_10PbarPiminus"]->fill(partPt);	//ratio numerator for Pbar/Pi- 0-10%
-						hPPi["AUAU0_10Pbar"]->fill(partPt);	//ratio numerator for Pbar/Pi0 0-10%
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C0_5)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for P+Pbar
+						hPPBank(TPBAR, R0_5)->fill(partPt);	//ratio numerator for Pbar/P 0-5%
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPiBank(TPBARPIMINUS, R0_10)->fill(partPt);	//ratio numerator for Pbar/Pi- 0-10%
+						hPPiBank(TPBAR, R0_10)->fill(partPt);	//ratio numerator for Pbar/Pi0 0-10%
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -730,37 +756,37 @@ namespace Rivet {
 			
 						case 211:	//pi+
 						
-							hPi["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Pions above 1.5GeV
+							hPiRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pions above 1.5GeV
 						
 							break;
 
 						case -211:	//pi-
 						
-							hPi["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Pions above 1.5GeV
+							hPiRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pions above 1.5GeV
 						
 							break;
 
 						case 321:	//K+
 	
-							//hK["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Kaons above 1.5GeV
+							//hKRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Kaons above 1.5GeV
 						
 							break;
 
 						case -321:	//K-
 				
-							//hK["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Kaons above 1.5GeV
+							//hKRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Kaons above 1.5GeV
 						
 							break;
 
 						case 2212:	//proton
 
-							//hP["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Protons above 1.5GeV
+							//hPRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Protons above 1.5GeV
 						
 							break;
 
 						case -2212:	//anti-proton
 
-							//hP["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Protons above 1.5GeV
+							//hPRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Protons above 1.5GeV
 						
 							break;
 					}
@@ -771,9 +797,9 @@ namespace Rivet {
 		
 				double partPt = p.pT()/GeV;
 
-				hPPi["AUAU0_10PPi0"]->fill(partPt);	//ratio denominator for P/Pi0 0-10%
-				hPPi["AUAU0_10PbarPi0"]->fill(partPt);	//ratio denominator for Pbar/Pi0 0-10%
-				hPi0["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for Pi0
+				hPPiBank(TPPI0, R0_10)->fill(partPt);	//ratio denominator for P/Pi0 0-10%
+				hPPiBank(TPBARPI0, R0_10)->fill(partPt);	//ratio denominator for Pbar/Pi0 0-10%
+				hPi0Rcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pi0
 			}
 		}
 
@@ -793,77 +819,77 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus10"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPi["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for Pi
-						hPPi["AUAU0_10Piplus"]->fill(partPt);	//ratio denominator for P/Pi+ 0-10%
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C5_10)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pi
+						hPPiBank(TPIPLUS, R0_10)->fill(partPt);	//ratio denominator for P/Pi+ 0-10%
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus10"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPi["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for Pi
-						hPPi["AUAU0_10Piminus"]->fill(partPt);	//ratio denominator for Pbar/Pi- 0-10%
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C5_10)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pi
+						hPPiBank(TPIMINUS, R0_10)->fill(partPt);	//ratio denominator for Pbar/Pi- 0-10%
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus10"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hK["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for K
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C5_10)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for K
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus10"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hK["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for K
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C5_10)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for K
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons10"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hP["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for P+Pbar
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPPi["AUAU0_10ProtonPiplus"]->fill(partPt);	//ratio numerator for P/Pi+ 0-10%
-						hPPi["AUAU0_10P"]->fill(partPt);	//ratio numerator for P/Pi0 0-10%
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C5_10)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for P+Pbar
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPiBank(TPROTONPIPLUS, R0_10)->fill(partPt);	//ratio numerator for P/Pi+ 0-10%
+						hPPiBank(TP, R0_10)->fill(partPt);	//ratio numerator for P/Pi0 0-10%
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar10"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hP["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for P+Pbar
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPPi["AUAU0_10PbarPiminus"]->fill(partPt);	//ratio numerator for Pbar/Pi- 0-10%
-						hPPi["AUAU0_10Pbar"]->fill(partPt);	//ratio numerator for Pbar/Pi0 0-10%
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C5_10)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPRcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for P+Pbar
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPiBank(TPBARPIMINUS, R0_10)->fill(partPt);	//ratio numerator for Pbar/Pi- 0-10%
+						hPPiBank(TPBAR, R0_10)->fill(partPt);	//ratio numerator for Pbar/Pi0 0-10%
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -874,37 +900,37 @@ namespace Rivet {
 			
 						case 211:	//pi+
 						
-							hPi["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Pions above 1.5GeV
+							hPiRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pions above 1.5GeV
 						
 							break;
 
 						case -211:	//pi-
 						
-							hPi["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Pions above 1.5GeV
+							hPiRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pions above 1.5GeV
 						
 							break;
 
 						case 321:	//K+
 	
-							//hK["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Kaons above 1.5GeV
+							//hKRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Kaons above 1.5GeV
 						
 							break;
 
 						case -321:	//K-
 				
-							//hK["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Kaons above 1.5GeV
+							//hKRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Kaons above 1.5GeV
 						
 							break;
 
 						case 2212:	//proton
 
-							//hP["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Protons above 1.5GeV
+							//hPRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Protons above 1.5GeV
 						
 							break;
 
 						case -2212:	//anti-proton
 
-							//hP["AUAU0_10GeV1_5"]->fill(p.pT()/GeV);	//Rcp numerator for Protons above 1.5GeV
+							//hPRcp(RCP1_5, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Protons above 1.5GeV
 						
 							break;
 					}
@@ -915,9 +941,9 @@ namespace Rivet {
 		
 				double partPt = p.pT()/GeV;
 
-				hPPi["AUAU0_10PPi0"]->fill(partPt);	//ratio denominator for P/Pi0 0-10%
-				hPPi["AUAU0_10PbarPi0"]->fill(partPt);	//ratio denominator for Pbar/Pi0 0-10%
-				hPi0["AUAU0_10"]->fill(p.pT()/GeV);	//Rcp numerator for Pi0
+				hPPiBank(TPPI0, R0_10)->fill(partPt);	//ratio denominator for P/Pi0 0-10%
+				hPPiBank(TPBARPI0, R0_10)->fill(partPt);	//ratio denominator for Pbar/Pi0 0-10%
+				hPi0Rcp(RCPALL, R0_10)->fill(p.pT()/GeV);	//Rcp numerator for Pi0
 			}
 		}
 
@@ -936,65 +962,65 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus15"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C10_15)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus15"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C10_15)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus15"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C10_15)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus15"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C10_15)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons15"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C10_15)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar15"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C10_15)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1016,65 +1042,65 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus20"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C15_20)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus20"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C15_20)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus20"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C15_20)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus20"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C15_20)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons20"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C15_20)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar20"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C15_20)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1096,71 +1122,71 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus30"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPPi["AUAU20_30Piplus"]->fill(partPt);	//ratio denominator for P/Pi+ 20-30%
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C20_30)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPPiBank(TPIPLUS, R20_30)->fill(partPt);	//ratio denominator for P/Pi+ 20-30%
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus30"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPPi["AUAU20_30Piminus"]->fill(partPt);	//ratio denominator for Pbar/Pi- 20-30%
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C20_30)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPPiBank(TPIMINUS, R20_30)->fill(partPt);	//ratio denominator for Pbar/Pi- 20-30%
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus30"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C20_30)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus30"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C20_30)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons30"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPPi["AUAU20_30ProtonPiplus"]->fill(partPt);	//ratio numerator for P/Pi+ 20-30%
-						hPPi["AUAU20_30P"]->fill(partPt);	//ratio numerator for P/Pi0 20-30%
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C20_30)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPiBank(TPROTONPIPLUS, R20_30)->fill(partPt);	//ratio numerator for P/Pi+ 20-30%
+						hPPiBank(TP, R20_30)->fill(partPt);	//ratio numerator for P/Pi0 20-30%
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar30"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPPi["AUAU20_30PbarPiminus"]->fill(partPt);	//ratio numerator for Pbar/Pi- 20-30%
-						hPPi["AUAU20_30Pbar"]->fill(partPt);	//ratio numerator for Pbar/Pi0 20-30%
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C20_30)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPiBank(TPBARPIMINUS, R20_30)->fill(partPt);	//ratio numerator for Pbar/Pi- 20-30%
+						hPPiBank(TPBAR, R20_30)->fill(partPt);	//ratio numerator for Pbar/Pi0 20-30%
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1170,8 +1196,8 @@ namespace Rivet {
 		
 				double partPt = p.pT()/GeV;
 
-				hPPi["AUAU20_30PPi0"]->fill(partPt);	//ratio denominator for P/Pi0 20-30%
-				hPPi["AUAU20_30PbarPi0"]->fill(partPt);	//ratio denominator for Pbar/Pi0 20-30%
+				hPPiBank(TPPI0, R20_30)->fill(partPt);	//ratio denominator for P/Pi0 20-30%
+				hPPiBank(TPBARPI0, R20_30)->fill(partPt);	//ratio denominator for Pbar/Pi0 20-30%
 			}
 		}
 
@@ -1190,65 +1216,65 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus40"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C30_40)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus40"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C30_40)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus40"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C30_40)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus40"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C30_40)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons40"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C30_40)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar40"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C30_40)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1270,65 +1296,65 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus50"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C40_50)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus50"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C40_50)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus50"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C40_50)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus50"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C40_50)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons50"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C40_50)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar50"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C40_50)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1350,65 +1376,65 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus60"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C50_60)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus60"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C50_60)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus60"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C50_60)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus60"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C50_60)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons60"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C50_60)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar60"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C50_60)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1430,65 +1456,65 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus70"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C60_70)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus70"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C60_70)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus70"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C60_70)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus70"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C60_70)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons70"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C60_70)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar70"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C60_70)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1510,65 +1536,65 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus80"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C70_80)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus80"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C70_80)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus80"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C70_80)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus80"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C70_80)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons80"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C70_80)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar80"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminPbar"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C70_80)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TPBAR, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1590,65 +1616,65 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piplus92"]->fill(partPt, pt_weight);
-						pmeanPt["Piplus"]->fill(c, partPtM);
-						hPiPi["AUAUPiplus"]->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
-						hKPi["AUAUPiplus"]->fill(c);	//ratio denominator for K+/Pi+
-						hPPi["AUAUPiplus"]->fill(c);	//ratio denominator for P/Pi+ vs c
+						hAUAU_Yields(PIPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIPLUS, C80_92)->fill(partPt, pt_weight);
+						pMeanPtBank(PIPLUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for Pi-/Pi+ vs c				
+						hKPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for K+/Pi+
+						hPPiBank(TPIPLUS, RCENT)->fill(c);	//ratio denominator for P/Pi+ vs c
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Piminus92"]->fill(partPt, pt_weight);
-						pmeanPt["Piminus"]->fill(c, partPtM);
-						hPiPi["AUAUPiminus"]->fill(c);	//ratio numerator for Pi-/Pi+ vs c
-						hKPi["AUAUPiminus"]->fill(c);	//ratio denominator for K-/Pi- vs c
-						hPPi["AUAUPiminus"]->fill(c);	//ratio denominator for Pbar/Pi- vs c
+						hAUAU_Yields(PIMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PIMINUS, C80_92)->fill(partPt, pt_weight);
+						pMeanPtBank(PIMINUS, 0)->fill(c, partPtM);
+						hPiPiBank(TPIMINUS, RCENT)->fill(c);	//ratio numerator for Pi-/Pi+ vs c
+						hKPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for K-/Pi- vs c
+						hPPiBank(TPIMINUS, RCENT)->fill(c);	//ratio denominator for Pbar/Pi- vs c
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kplus92"]->fill(partPt, pt_weight);			
-						pmeanPt["Kplus"]->fill(c, partPtM);
-						hKK["AUAUKplus"]->fill(c);	//ratio denominator for K-/K+ vs c
-						hKPi["AUAUKplus"]->fill(c);	//ratio numerator for K+/Pi+ vs c
+						hAUAU_Yields(KPLUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KPLUS, C80_92)->fill(partPt, pt_weight);			
+						pMeanPtBank(KPLUS, 0)->fill(c, partPtM);
+						hKKBank(TKPLUS, RCENT)->fill(c);	//ratio denominator for K-/K+ vs c
+						hKPiBank(TKPLUS, RCENT)->fill(c);	//ratio numerator for K+/Pi+ vs c
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminusmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Kminus92"]->fill(partPt, pt_weight);
-						pmeanPt["Kminus"]->fill(c, partPtM);
-						hKK["AUAUKminus"]->fill(c);	//ratio numerator for K-/K+ vs c
-						hKPi["AUAUKminus"]->fill(c);	//ratio numerator for K-/Pi- vs c
+						hAUAU_Yields(KMINUS, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(KMINUS, C80_92)->fill(partPt, pt_weight);
+						pMeanPtBank(KMINUS, 0)->fill(c, partPtM);
+						hKKBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/K+ vs c
+						hKPiBank(TKMINUS, RCENT)->fill(c);	//ratio numerator for K-/Pi- vs c
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protonsmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Protons92"]->fill(partPt, pt_weight);			
-						pmeanPt["Protons"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
-						hPP["AUAUP"]->fill(c);		//ratio denominator for Pbar/P vs c
-						hPPi["AUAUP"]->fill(c);		//ratio numerator for P/Pi+ vs c
+						hAUAU_Yields(PROTON, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PROTON, C80_92)->fill(partPt, pt_weight);			
+						pMeanPtBank(PROTON, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);		//ratio denominator for Pbar/P minimum bias	
+						hPPBank(TP, RCENT)->fill(c);		//ratio denominator for Pbar/P vs c
+						hPPiBank(TP, RCENT)->fill(c);		//ratio numerator for P/Pi+ vs c
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbarmin"]->fill(partPt, pt_weight);
-						hAUAU_Yields["Pbar92"]->fill(partPt, pt_weight);	
-						pmeanPt["Pbar"]->fill(c, partPtM);
-						hPP["AUAUminP"]->fill(partPt);	//ratio numerator for Pbar/P minimum bias
-						hPP["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/P vs c
-						hPPi["AUAUPbar"]->fill(c);	//ratio numerator for Pbar/Pi- vs c
+						hAUAU_Yields(PBAR, CMIN)->fill(partPt, pt_weight);
+						hAUAU_Yields(PBAR, C80_92)->fill(partPt, pt_weight);	
+						pMeanPtBank(PBAR, 0)->fill(c, partPtM);
+						hPPBank(TP, RMIN)->fill(partPt);	//ratio numerator for Pbar/P minimum bias
+						hPPBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/P vs c
+						hPPiBank(TPBAR, RCENT)->fill(c);	//ratio numerator for Pbar/Pi- vs c
 
 						break;
 				}
@@ -1668,59 +1694,59 @@ namespace Rivet {
 		
 					case 211:	//pi+
 						
-						hAUAU_Yields["Piplus60_92"]->fill(partPt, pt_weight);
-						hPi["AUAU60_92"]->fill(p.pT()/GeV);	//Rcp denominator for Pi
-						hPiPi["AUAU60_92Piplus"]->fill(partPt);	//ratio denominator for Pi-/Pi+ 60-92%
-						hKPi["AUAU60_92Piplus"]->fill(partPt);	//ratio denominator for K+/Pi+ 60-92%
-						hPPi["AUAU60_92Piplus"]->fill(partPt);	//ratio denominator for P/Pi+ 60-92%
+						hAUAU_Yields(PIPLUS, C60_92)->fill(partPt, pt_weight);
+						hPiRcp(RCPALL, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Pi
+						hPiPiBank(TPIPLUS, R60_92)->fill(partPt);	//ratio denominator for Pi-/Pi+ 60-92%
+						hKPiBank(TPIPLUS, R60_92)->fill(partPt);	//ratio denominator for K+/Pi+ 60-92%
+						hPPiBank(TPIPLUS, R60_92)->fill(partPt);	//ratio denominator for P/Pi+ 60-92%
 
 						break;
 			
 					case -211:	//pi-
 						
-						hAUAU_Yields["Piminus60_92"]->fill(partPt, pt_weight);
-						hPi["AUAU60_92"]->fill(p.pT()/GeV);	//Rcp denominator for Pi
-						hPiPi["AUAU60_92Piminus"]->fill(partPt);	//ratio numerator for Pi-/Pi+ 60-92%
-						hKPi["AUAU60_92Piminus"]->fill(partPt);	//ratio denominator for K-/Pi- 60-92%
-						hPPi["AUAU60_92Piminus"]->fill(partPt);	//ratio denominator for Pbar/Pi- 60-92%
+						hAUAU_Yields(PIMINUS, C60_92)->fill(partPt, pt_weight);
+						hPiRcp(RCPALL, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Pi
+						hPiPiBank(TPIMINUS, R60_92)->fill(partPt);	//ratio numerator for Pi-/Pi+ 60-92%
+						hKPiBank(TPIMINUS, R60_92)->fill(partPt);	//ratio denominator for K-/Pi- 60-92%
+						hPPiBank(TPIMINUS, R60_92)->fill(partPt);	//ratio denominator for Pbar/Pi- 60-92%
 
 						break;
 					
 					case 321:	//K+
 						
-						hAUAU_Yields["Kplus60_92"]->fill(partPt, pt_weight);			
-						hK["AUAU60_92"]->fill(p.pT()/GeV);	//Rcp denominator for K
-						hKK["AUAU60_92Kplus"]->fill(partPt);	//ratio denominator for K-/K+ 60-92%
-						hKPi["AUAU60_92Kplus"]->fill(partPt);	//ratio numerator for K+/Pi+ 60-92%
+						hAUAU_Yields(KPLUS, C60_92)->fill(partPt, pt_weight);			
+						hKRcp(RCPALL, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for K
+						hKKBank(TKPLUS, R60_92)->fill(partPt);	//ratio denominator for K-/K+ 60-92%
+						hKPiBank(TKPLUS, R60_92)->fill(partPt);	//ratio numerator for K+/Pi+ 60-92%
 
 						break;
 
 					case -321:	//K-
 						
-						hAUAU_Yields["Kminus60_92"]->fill(partPt, pt_weight);
-						hK["AUAU60_92"]->fill(p.pT()/GeV);	//Rcp denominator for K
-						hKK["AUAU60_92Kplus"]->fill(partPt);	//ratio numerator for K-/K+ 60-92%
-						hKPi["AUAU60_92Kminus"]->fill(partPt);	//ratio numerator for K-/Pi- 60-92%
+						hAUAU_Yields(KMINUS, C60_92)->fill(partPt, pt_weight);
+						hKRcp(RCPALL, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for K
+						hKKBank(TKPLUS, R60_92)->fill(partPt);	//ratio numerator for K-/K+ 60-92%
+						hKPiBank(TKMINUS, R60_92)->fill(partPt);	//ratio numerator for K-/Pi- 60-92%
 
 						break;
 					
 					case 2212:	//proton
 						
-						hAUAU_Yields["Protons60_92"]->fill(partPt, pt_weight);			
-						hP["AUAU60_92"]->fill(p.pT()/GeV);	//Rcp denominator for P+Pbar
-						hPP["AUAU60_92P"]->fill(partPt);	//ratio denominator for Pbar/P 60-92%	
-						hPPi["AUAU60_92ProtonPiplus"]->fill(partPt);	//ratio numerator for P/Pi+ 60-92%
-						hPPi["AUAU60_92P"]->fill(partPt);	//ratio numerator for P/Pi0 60-92%
+						hAUAU_Yields(PROTON, C60_92)->fill(partPt, pt_weight);			
+						hPRcp(RCPALL, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for P+Pbar
+						hPPBank(TP, R60_92)->fill(partPt);	//ratio denominator for Pbar/P 60-92%	
+						hPPiBank(TPROTONPIPLUS, R60_92)->fill(partPt);	//ratio numerator for P/Pi+ 60-92%
+						hPPiBank(TP, R60_92)->fill(partPt);	//ratio numerator for P/Pi0 60-92%
 
 						break;
 
 					case -2212:	//antiproton
 						
-						hAUAU_Yields["Pbar60_92"]->fill(partPt, pt_weight);	
-						hP["AUAU60_92"]->fill(p.pT()/GeV);	//Rcp denominator for P+Pbar
-						hPP["AUAU60_92Pbar"]->fill(partPt);	//ratio numerator for Pbar/P 60-92%
-						hPPi["AUAU60_92PbarPiminus"]->fill(partPt);	//ratio numerator for Pbar/Pi- 60-92%
-						hPPi["AUAU60_92Pbar"]->fill(partPt);	//ratio numerator for Pbar/Pi0 60-92%
+						hAUAU_Yields(PBAR, C60_92)->fill(partPt, pt_weight);	
+						hPRcp(RCPALL, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for P+Pbar
+						hPPBank(TPBAR, R60_92)->fill(partPt);	//ratio numerator for Pbar/P 60-92%
+						hPPiBank(TPBARPIMINUS, R60_92)->fill(partPt);	//ratio numerator for Pbar/Pi- 60-92%
+						hPPiBank(TPBAR, R60_92)->fill(partPt);	//ratio numerator for Pbar/Pi0 60-92%
 
 						break;
 				}
@@ -1731,37 +1757,37 @@ namespace Rivet {
 			
 						case 211:	//pi+
 						
-							hPi["AUAU60_92GeV1_5"]->fill(p.pT()/GeV);	//Rcp denominator for Pions above 1.5GeV
+							hPiRcp(RCP1_5, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Pions above 1.5GeV
 						
 							break;
 
 						case -211:	//pi-
 						
-							hPi["AUAU60_92GeV1_5"]->fill(p.pT()/GeV);	//Rcp denominator for Pions above 1.5GeV
+							hPiRcp(RCP1_5, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Pions above 1.5GeV
 						
 							break;
 
 						case 321:	//K+
 	
-							//hK["AUAU60_92GeV1_5"]->fill(p.pT()/GeV);	//Rcp denominator for Kaons above 1.5GeV
+							//hKRcp(RCP1_5, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Kaons above 1.5GeV
 						
 							break;
 
 						case -321:	//K-
 				
-							//hK["AUAU60_92GeV1_5"]->fill(p.pT()/GeV);	//Rcp denominator for Kaons above 1.5GeV
+							//hKRcp(RCP1_5, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Kaons above 1.5GeV
 						
 							break;
 
 						case 2212:	//proton
 
-							//hP["AUAU60_92GeV1_5"]->fill(p.pT()/GeV);	//Rcp denominator for Protons above 1.5GeV
+							//hPRcp(RCP1_5, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Protons above 1.5GeV
 						
 							break;
 
 						case -2212:	//anti-proton
 
-							//hP["AUAU60_92GeV1_5"]->fill(p.pT()/GeV);	//Rcp denominator for Protons above 1.5GeV
+							//hPRcp(RCP1_5, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Protons above 1.5GeV
 						
 							break;
 					}
@@ -1772,98 +1798,16 @@ namespace Rivet {
 		
 				double partPt = p.pT()/GeV;
 
-				hPPi["AUAU60_92PPi0"]->fill(partPt);	//ratio denominator for P/Pi0 60-92%
-				hPPi["AUAU60_92PbarPi0"]->fill(partPt);	//ratio denominator for Pbar/Pi0 60-92%
-				hPi0["AUAU60_92"]->fill(p.pT()/GeV);	//Rcp denominator for Pi0
+				hPPiBank(TPPI0, R60_92)->fill(partPt);	//ratio denominator for P/Pi0 60-92%
+				hPPiBank(TPBARPI0, R60_92)->fill(partPt);	//ratio denominator for Pbar/Pi0 60-92%
+				hPi0Rcp(RCPALL, R60_92)->fill(p.pT()/GeV);	//Rcp denominator for Pi0
 			}
 		}
 	}
 
 
 	void finalize() {
-		binShift(*hAUAU_Yields["Piplusmin"]);
-		binShift(*hAUAU_Yields["Piplus5"]);
-		binShift(*hAUAU_Yields["Piplus10"]);
-		binShift(*hAUAU_Yields["Piplus15"]);
-		binShift(*hAUAU_Yields["Piplus20"]);
-		binShift(*hAUAU_Yields["Piplus30"]);
-		binShift(*hAUAU_Yields["Piplus40"]);
-		binShift(*hAUAU_Yields["Piplus50"]);
-		binShift(*hAUAU_Yields["Piplus60"]);
-		binShift(*hAUAU_Yields["Piplus70"]);
-		binShift(*hAUAU_Yields["Piplus80"]);
-		binShift(*hAUAU_Yields["Piplus92"]);
-		binShift(*hAUAU_Yields["Piplus60_92"]);
-
-		binShift(*hAUAU_Yields["Piminusmin"]);
-		binShift(*hAUAU_Yields["Piminus5"]);
-		binShift(*hAUAU_Yields["Piminus10"]);
-		binShift(*hAUAU_Yields["Piminus15"]);
-		binShift(*hAUAU_Yields["Piminus20"]);
-		binShift(*hAUAU_Yields["Piminus30"]);
-		binShift(*hAUAU_Yields["Piminus40"]);
-		binShift(*hAUAU_Yields["Piminus50"]);
-		binShift(*hAUAU_Yields["Piminus60"]);
-		binShift(*hAUAU_Yields["Piminus70"]);
-		binShift(*hAUAU_Yields["Piminus80"]);
-		binShift(*hAUAU_Yields["Piminus92"]);
-		binShift(*hAUAU_Yields["Piminus60_92"]);
-
-		binShift(*hAUAU_Yields["Kplusmin"]);
-		binShift(*hAUAU_Yields["Kplus5"]);
-		binShift(*hAUAU_Yields["Kplus10"]);
-		binShift(*hAUAU_Yields["Kplus15"]);
-		binShift(*hAUAU_Yields["Kplus20"]);
-		binShift(*hAUAU_Yields["Kplus30"]);
-		binShift(*hAUAU_Yields["Kplus40"]);
-		binShift(*hAUAU_Yields["Kplus50"]);
-		binShift(*hAUAU_Yields["Kplus60"]);
-		binShift(*hAUAU_Yields["Kplus70"]);
-		binShift(*hAUAU_Yields["Kplus80"]);
-		binShift(*hAUAU_Yields["Kplus92"]);
-		binShift(*hAUAU_Yields["Kplus60_92"]);
-
-		binShift(*hAUAU_Yields["Kminusmin"]);
-		binShift(*hAUAU_Yields["Kminus5"]);
-		binShift(*hAUAU_Yields["Kminus10"]);
-		binShift(*hAUAU_Yields["Kminus15"]);
-		binShift(*hAUAU_Yields["Kminus20"]);
-		binShift(*hAUAU_Yields["Kminus30"]);
-		binShift(*hAUAU_Yields["Kminus40"]);
-		binShift(*hAUAU_Yields["Kminus50"]);
-		binShift(*hAUAU_Yields["Kminus60"]);
-		binShift(*hAUAU_Yields["Kminus70"]);
-		binShift(*hAUAU_Yields["Kminus80"]);
-		binShift(*hAUAU_Yields["Kminus92"]);
-		binShift(*hAUAU_Yields["Kminus60_92"]);
-
-		binShift(*hAUAU_Yields["Protonsmin"]);
-		binShift(*hAUAU_Yields["Protons5"]);
-		binShift(*hAUAU_Yields["Protons10"]);
-		binShift(*hAUAU_Yields["Protons15"]);
-		binShift(*hAUAU_Yields["Protons20"]);
-		binShift(*hAUAU_Yields["Protons30"]);
-		binShift(*hAUAU_Yields["Protons40"]);
-		binShift(*hAUAU_Yields["Protons50"]);
-		binShift(*hAUAU_Yields["Protons60"]);
-		binShift(*hAUAU_Yields["Protons70"]);
-		binShift(*hAUAU_Yields["Protons80"]);
-		binShift(*hAUAU_Yields["Protons92"]);
-		binShift(*hAUAU_Yields["Protons60_92"]);
-
-		binShift(*hAUAU_Yields["Pbarmin"]);
-		binShift(*hAUAU_Yields["Pbar5"]);
-		binShift(*hAUAU_Yields["Pbar10"]);
-		binShift(*hAUAU_Yields["Pbar15"]);
-		binShift(*hAUAU_Yields["Pbar20"]);
-		binShift(*hAUAU_Yields["Pbar30"]);
-		binShift(*hAUAU_Yields["Pbar40"]);
-		binShift(*hAUAU_Yields["Pbar50"]);
-		binShift(*hAUAU_Yields["Pbar60"]);
-		binShift(*hAUAU_Yields["Pbar70"]);
-		binShift(*hAUAU_Yields["Pbar80"]);
-		binShift(*hAUAU_Yields["Pbar92"]);
-		binShift(*hAUAU_Yields["Pbar60_92"]);
+		for(Histo1DPtr& h : hAUAU_Yields) binShift(*h);
 
 		binShift(*hPiPi["AUAU0_5Piminus"]); 
 		binShift(*hPiPi["AUAU0_5Piplus"]); 
@@ -1890,96 +1834,96 @@ namespace Rivet {
 
 
 		//____Yields____
-		hAUAU_Yields["Piplusmin"]->scaleW(1./sow["sow_AUAUmin"]->sumW());	//minimum bias centrality
-		hAUAU_Yields["Piminusmin"]->scaleW(1./sow["sow_AUAUmin"]->sumW());
-		hAUAU_Yields["Kplusmin"]->scaleW(1./sow["sow_AUAUmin"]->sumW());
-		hAUAU_Yields["Kminusmin"]->scaleW(1./sow["sow_AUAUmin"]->sumW());
-		hAUAU_Yields["Protonsmin"]->scaleW(1./sow["sow_AUAUmin"]->sumW());
-		hAUAU_Yields["Pbarmin"]->scaleW(1./sow["sow_AUAUmin"]->sumW());
-
-		hAUAU_Yields["Piplus5"]->scaleW(1./sow["sow_AUAU5"]->sumW());	//0-5% centrality
-		hAUAU_Yields["Piminus5"]->scaleW(1./sow["sow_AUAU5"]->sumW());
-		hAUAU_Yields["Kplus5"]->scaleW(1./sow["sow_AUAU5"]->sumW());
-		hAUAU_Yields["Kminus5"]->scaleW(1./sow["sow_AUAU5"]->sumW());
-		hAUAU_Yields["Protons5"]->scaleW(1./sow["sow_AUAU5"]->sumW());
-		hAUAU_Yields["Pbar5"]->scaleW(1./sow["sow_AUAU5"]->sumW());
-
-		hAUAU_Yields["Piplus10"]->scaleW(1./sow["sow_AUAU10"]->sumW());	//5-10% centrality
-		hAUAU_Yields["Piminus10"]->scaleW(1./sow["sow_AUAU10"]->sumW());
-		hAUAU_Yields["Kplus10"]->scaleW(1./sow["sow_AUAU10"]->sumW());
-		hAUAU_Yields["Kminus10"]->scaleW(1./sow["sow_AUAU10"]->sumW());
-		hAUAU_Yields["Protons10"]->scaleW(1./sow["sow_AUAU10"]->sumW());
-		hAUAU_Yields["Pbar10"]->scaleW(1./sow["sow_AUAU10"]->sumW());
-
-		hAUAU_Yields["Piplus15"]->scaleW(1./sow["sow_AUAU15"]->sumW());	//10-15% centrality
-		hAUAU_Yields["Piminus15"]->scaleW(1./sow["sow_AUAU15"]->sumW());
-		hAUAU_Yields["Kplus15"]->scaleW(1./sow["sow_AUAU15"]->sumW());
-		hAUAU_Yields["Kminus15"]->scaleW(1./sow["sow_AUAU15"]->sumW());
-		hAUAU_Yields["Protons15"]->scaleW(1./sow["sow_AUAU15"]->sumW());
-		hAUAU_Yields["Pbar15"]->scaleW(1./sow["sow_AUAU15"]->sumW());
-
-		hAUAU_Yields["Piplus20"]->scaleW(1./sow["sow_AUAU20"]->sumW());	//15-20% centrality
-		hAUAU_Yields["Piminus20"]->scaleW(1./sow["sow_AUAU20"]->sumW());
-		hAUAU_Yields["Kplus20"]->scaleW(1./sow["sow_AUAU20"]->sumW());
-		hAUAU_Yields["Kminus20"]->scaleW(1./sow["sow_AUAU20"]->sumW());
-		hAUAU_Yields["Protons20"]->scaleW(1./sow["sow_AUAU20"]->sumW());
-		hAUAU_Yields["Pbar20"]->scaleW(1./sow["sow_AUAU20"]->sumW());
-
-		hAUAU_Yields["Piplus30"]->scaleW(1./sow["sow_AUAU30"]->sumW());	//20-30% centrality
-		hAUAU_Yields["Piminus30"]->scaleW(1./sow["sow_AUAU30"]->sumW());
-		hAUAU_Yields["Kplus30"]->scaleW(1./sow["sow_AUAU30"]->sumW());
-		hAUAU_Yields["Kminus30"]->scaleW(1./sow["sow_AUAU30"]->sumW());
-		hAUAU_Yields["Protons30"]->scaleW(1./sow["sow_AUAU30"]->sumW());
-		hAUAU_Yields["Pbar30"]->scaleW(1./sow["sow_AUAU30"]->sumW());
-
-		hAUAU_Yields["Piplus40"]->scaleW(1./sow["sow_AUAU40"]->sumW());	//30-40% centrality
-		hAUAU_Yields["Piminus40"]->scaleW(1./sow["sow_AUAU40"]->sumW());
-		hAUAU_Yields["Kplus40"]->scaleW(1./sow["sow_AUAU40"]->sumW());
-		hAUAU_Yields["Kminus40"]->scaleW(1./sow["sow_AUAU40"]->sumW());
-		hAUAU_Yields["Protons40"]->scaleW(1./sow["sow_AUAU40"]->sumW());
-		hAUAU_Yields["Pbar40"]->scaleW(1./sow["sow_AUAU40"]->sumW());
-
-		hAUAU_Yields["Piplus50"]->scaleW(1./sow["sow_AUAU50"]->sumW());	//40-50% centrality
-		hAUAU_Yields["Piminus50"]->scaleW(1./sow["sow_AUAU50"]->sumW());
-		hAUAU_Yields["Kplus50"]->scaleW(1./sow["sow_AUAU50"]->sumW());
-		hAUAU_Yields["Kminus50"]->scaleW(1./sow["sow_AUAU50"]->sumW());
-		hAUAU_Yields["Protons50"]->scaleW(1./sow["sow_AUAU50"]->sumW());
-		hAUAU_Yields["Pbar50"]->scaleW(1./sow["sow_AUAU50"]->sumW());
-
-		hAUAU_Yields["Piplus60"]->scaleW(1./sow["sow_AUAU60"]->sumW());	//50-60% centrality
-		hAUAU_Yields["Piminus60"]->scaleW(1./sow["sow_AUAU60"]->sumW());
-		hAUAU_Yields["Kplus60"]->scaleW(1./sow["sow_AUAU60"]->sumW());
-		hAUAU_Yields["Kminus60"]->scaleW(1./sow["sow_AUAU60"]->sumW());
-		hAUAU_Yields["Protons60"]->scaleW(1./sow["sow_AUAU60"]->sumW());
-		hAUAU_Yields["Pbar60"]->scaleW(1./sow["sow_AUAU60"]->sumW());
-
-		hAUAU_Yields["Piplus70"]->scaleW(1./sow["sow_AUAU70"]->sumW());	//60-70% centrality
-		hAUAU_Yields["Piminus70"]->scaleW(1./sow["sow_AUAU70"]->sumW());
-		hAUAU_Yields["Kplus70"]->scaleW(1./sow["sow_AUAU70"]->sumW());
-		hAUAU_Yields["Kminus70"]->scaleW(1./sow["sow_AUAU70"]->sumW());
-		hAUAU_Yields["Protons70"]->scaleW(1./sow["sow_AUAU70"]->sumW());
-		hAUAU_Yields["Pbar70"]->scaleW(1./sow["sow_AUAU70"]->sumW());
-
-		hAUAU_Yields["Piplus80"]->scaleW(1./sow["sow_AUAU80"]->sumW());	//70-80% centrality
-		hAUAU_Yields["Piminus80"]->scaleW(1./sow["sow_AUAU80"]->sumW());
-		hAUAU_Yields["Kplus80"]->scaleW(1./sow["sow_AUAU80"]->sumW());
-		hAUAU_Yields["Kminus80"]->scaleW(1./sow["sow_AUAU80"]->sumW());
-		hAUAU_Yields["Protons80"]->scaleW(1./sow["sow_AUAU80"]->sumW());
-		hAUAU_Yields["Pbar80"]->scaleW(1./sow["sow_AUAU80"]->sumW());
-
-		hAUAU_Yields["Piplus92"]->scaleW(1./sow["sow_AUAU92"]->sumW());	//80-92% centrality
-		hAUAU_Yields["Piminus92"]->scaleW(1./sow["sow_AUAU92"]->sumW());
-		hAUAU_Yields["Kplus92"]->scaleW(1./sow["sow_AUAU92"]->sumW());
-		hAUAU_Yields["Kminus92"]->scaleW(1./sow["sow_AUAU92"]->sumW());
-		hAUAU_Yields["Protons92"]->scaleW(1./sow["sow_AUAU92"]->sumW());
-		hAUAU_Yields["Pbar92"]->scaleW(1./sow["sow_AUAU92"]->sumW());
-
-		hAUAU_Yields["Piplus60_92"]->scaleW(1./sow["sow_AUAU_60_92"]->sumW());	//60-92% centrality
-		hAUAU_Yields["Piminus60_92"]->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
-		hAUAU_Yields["Kplus60_92"]->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
-		hAUAU_Yields["Kminus60_92"]->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
-		hAUAU_Yields["Protons60_92"]->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
-		hAUAU_Yields["Pbar60_92"]->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
+		hAUAU_Yields(PIPLUS, CMIN)->scaleW(1./sow["sow_AUAUmin"]->sumW());	//minimum bias centrality
+		hAUAU_Yields(PIMINUS, CMIN)->scaleW(1./sow["sow_AUAUmin"]->sumW());
+		hAUAU_Yields(KPLUS, CMIN)->scaleW(1./sow["sow_AUAUmin"]->sumW());
+		hAUAU_Yields(KMINUS, CMIN)->scaleW(1./sow["sow_AUAUmin"]->sumW());
+		hAUAU_Yields(PROTON, CMIN)->scaleW(1./sow["sow_AUAUmin"]->sumW());
+		hAUAU_Yields(PBAR, CMIN)->scaleW(1./sow["sow_AUAUmin"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C0_5)->scaleW(1./sow["sow_AUAU5"]->sumW());	//0-5% centrality
+		hAUAU_Yields(PIMINUS, C0_5)->scaleW(1./sow["sow_AUAU5"]->sumW());
+		hAUAU_Yields(KPLUS, C0_5)->scaleW(1./sow["sow_AUAU5"]->sumW());
+		hAUAU_Yields(KMINUS, C0_5)->scaleW(1./sow["sow_AUAU5"]->sumW());
+		hAUAU_Yields(PROTON, C0_5)->scaleW(1./sow["sow_AUAU5"]->sumW());
+		hAUAU_Yields(PBAR, C0_5)->scaleW(1./sow["sow_AUAU5"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C5_10)->scaleW(1./sow["sow_AUAU10"]->sumW());	//5-10% centrality
+		hAUAU_Yields(PIMINUS, C5_10)->scaleW(1./sow["sow_AUAU10"]->sumW());
+		hAUAU_Yields(KPLUS, C5_10)->scaleW(1./sow["sow_AUAU10"]->sumW());
+		hAUAU_Yields(KMINUS, C5_10)->scaleW(1./sow["sow_AUAU10"]->sumW());
+		hAUAU_Yields(PROTON, C5_10)->scaleW(1./sow["sow_AUAU10"]->sumW());
+		hAUAU_Yields(PBAR, C5_10)->scaleW(1./sow["sow_AUAU10"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C10_15)->scaleW(1./sow["sow_AUAU15"]->sumW());	//10-15% centrality
+		hAUAU_Yields(PIMINUS, C10_15)->scaleW(1./sow["sow_AUAU15"]->sumW());
+		hAUAU_Yields(KPLUS, C10_15)->scaleW(1./sow["sow_AUAU15"]->sumW());
+		hAUAU_Yields(KMINUS, C10_15)->scaleW(1./sow["sow_AUAU15"]->sumW());
+		hAUAU_Yields(PROTON, C10_15)->scaleW(1./sow["sow_AUAU15"]->sumW());
+		hAUAU_Yields(PBAR, C10_15)->scaleW(1./sow["sow_AUAU15"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C15_20)->scaleW(1./sow["sow_AUAU20"]->sumW());	//15-20% centrality
+		hAUAU_Yields(PIMINUS, C15_20)->scaleW(1./sow["sow_AUAU20"]->sumW());
+		hAUAU_Yields(KPLUS, C15_20)->scaleW(1./sow["sow_AUAU20"]->sumW());
+		hAUAU_Yields(KMINUS, C15_20)->scaleW(1./sow["sow_AUAU20"]->sumW());
+		hAUAU_Yields(PROTON, C15_20)->scaleW(1./sow["sow_AUAU20"]->sumW());
+		hAUAU_Yields(PBAR, C15_20)->scaleW(1./sow["sow_AUAU20"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C20_30)->scaleW(1./sow["sow_AUAU30"]->sumW());	//20-30% centrality
+		hAUAU_Yields(PIMINUS, C20_30)->scaleW(1./sow["sow_AUAU30"]->sumW());
+		hAUAU_Yields(KPLUS, C20_30)->scaleW(1./sow["sow_AUAU30"]->sumW());
+		hAUAU_Yields(KMINUS, C20_30)->scaleW(1./sow["sow_AUAU30"]->sumW());
+		hAUAU_Yields(PROTON, C20_30)->scaleW(1./sow["sow_AUAU30"]->sumW());
+		hAUAU_Yields(PBAR, C20_30)->scaleW(1./sow["sow_AUAU30"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C30_40)->scaleW(1./sow["sow_AUAU40"]->sumW());	//30-40% centrality
+		hAUAU_Yields(PIMINUS, C30_40)->scaleW(1./sow["sow_AUAU40"]->sumW());
+		hAUAU_Yields(KPLUS, C30_40)->scaleW(1./sow["sow_AUAU40"]->sumW());
+		hAUAU_Yields(KMINUS, C30_40)->scaleW(1./sow["sow_AUAU40"]->sumW());
+		hAUAU_Yields(PROTON, C30_40)->scaleW(1./sow["sow_AUAU40"]->sumW());
+		hAUAU_Yields(PBAR, C30_40)->scaleW(1./sow["sow_AUAU40"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C40_50)->scaleW(1./sow["sow_AUAU50"]->sumW());	//40-50% centrality
+		hAUAU_Yields(PIMINUS, C40_50)->scaleW(1./sow["sow_AUAU50"]->sumW());
+		hAUAU_Yields(KPLUS, C40_50)->scaleW(1./sow["sow_AUAU50"]->sumW());
+		hAUAU_Yields(KMINUS, C40_50)->scaleW(1./sow["sow_AUAU50"]->sumW());
+		hAUAU_Yields(PROTON, C40_50)->scaleW(1./sow["sow_AUAU50"]->sumW());
+		hAUAU_Yields(PBAR, C40_50)->scaleW(1./sow["sow_AUAU50"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C50_60)->scaleW(1./sow["sow_AUAU60"]->sumW());	//50-60% centrality
+		hAUAU_Yields(PIMINUS, C50_60)->scaleW(1./sow["sow_AUAU60"]->sumW());
+		hAUAU_Yields(KPLUS, C50_60)->scaleW(1./sow["sow_AUAU60"]->sumW());
+		hAUAU_Yields(KMINUS, C50_60)->scaleW(1./sow["sow_AUAU60"]->sumW());
+		hAUAU_Yields(PROTON, C50_60)->scaleW(1./sow["sow_AUAU60"]->sumW());
+		hAUAU_Yields(PBAR, C50_60)->scaleW(1./sow["sow_AUAU60"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C60_70)->scaleW(1./sow["sow_AUAU70"]->sumW());	//60-70% centrality
+		hAUAU_Yields(PIMINUS, C60_70)->scaleW(1./sow["sow_AUAU70"]->sumW());
+		hAUAU_Yields(KPLUS, C60_70)->scaleW(1./sow["sow_AUAU70"]->sumW());
+		hAUAU_Yields(KMINUS, C60_70)->scaleW(1./sow["sow_AUAU70"]->sumW());
+		hAUAU_Yields(PROTON, C60_70)->scaleW(1./sow["sow_AUAU70"]->sumW());
+		hAUAU_Yields(PBAR, C60_70)->scaleW(1./sow["sow_AUAU70"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C70_80)->scaleW(1./sow["sow_AUAU80"]->sumW());	//70-80% centrality
+		hAUAU_Yields(PIMINUS, C70_80)->scaleW(1./sow["sow_AUAU80"]->sumW());
+		hAUAU_Yields(KPLUS, C70_80)->scaleW(1./sow["sow_AUAU80"]->sumW());
+		hAUAU_Yields(KMINUS, C70_80)->scaleW(1./sow["sow_AUAU80"]->sumW());
+		hAUAU_Yields(PROTON, C70_80)->scaleW(1./sow["sow_AUAU80"]->sumW());
+		hAUAU_Yields(PBAR, C70_80)->scaleW(1./sow["sow_AUAU80"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C80_92)->scaleW(1./sow["sow_AUAU92"]->sumW());	//80-92% centrality
+		hAUAU_Yields(PIMINUS, C80_92)->scaleW(1./sow["sow_AUAU92"]->sumW());
+		hAUAU_Yields(KPLUS, C80_92)->scaleW(1./sow["sow_AUAU92"]->sumW());
+		hAUAU_Yields(KMINUS, C80_92)->scaleW(1./sow["sow_AUAU92"]->sumW());
+		hAUAU_Yields(PROTON, C80_92)->scaleW(1./sow["sow_AUAU92"]->sumW());
+		hAUAU_Yields(PBAR, C80_92)->scaleW(1./sow["sow_AUAU92"]->sumW());
+
+		hAUAU_Yields(PIPLUS, C60_92)->scaleW(1./sow["sow_AUAU_60_92"]->sumW());	//60-92% centrality
+		hAUAU_Yields(PIMINUS, C60_92)->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
+		hAUAU_Yields(KPLUS, C60_92)->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
+		hAUAU_Yields(KMINUS, C60_92)->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
+		hAUAU_Yields(PROTON, C60_92)->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
+		hAUAU_Yields(PBAR, C60_92)->scaleW(1./sow["sow_AUAU_60_92"]->sumW());
 
 
 		//____Rcp____
@@ -2077,7 +2021,18 @@ namespace Rivet {
 
 	}
 
-	map<string, Histo1DPtr> hAUAU_Yields;
+	enum Species {PIPLUS, PIMINUS, KPLUS, KMINUS, PROTON, PBAR, NSPECIES};
+	enum CentralityClass {CMIN, C0_5, C5_10, C10_15, C15_20, C20_30, C30_40, C40_50, C50_60, C60_70, C70_80, C80_92, C60_92, NCENT};
+	HistoBank<NSPECIES, NCENT> hAUAU_Yields;
+	// Per-particle fill handles: ratio histograms by term and class ("AUAU" +
+	// class + term in the maps, the "" class being the one filled vs. centrality)
+	// and Rcp numerators by pT cut and class
+	enum RatioClass {RMIN, R0_5, R0_10, R20_30, R60_92, RCENT, NRATIOCLASS};
+	enum RatioTerm {TPIPLUS, TPIMINUS, TKPLUS, TKMINUS, TP, TPBAR, TPPI0, TPBARPI0, TPBARPIMINUS, TPROTONPIPLUS, NRATIOTERM};
+	enum RcpCut {RCPALL, RCP1_5, NRCPCUT};
+	HistoBank<NSPECIES, 1, 1, Profile1DPtr> pMeanPtBank;
+	HistoBank<NRATIOTERM, NRATIOCLASS> hPiPiBank, hKPiBank, hPPiBank, hKKBank, hPPBank;
+	HistoBank<NRCPCUT, NRATIOCLASS> hPiRcp, hKRcp, hPRcp, hPi0Rcp;
 	map<string, CounterPtr> sow;
 	map<string, Profile1DPtr> pmeanPt;
 	map<string, Profile1DPtr> pdN_dy;
@@ -12,6 +12,9 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/InvariantYield.hh"
+#include "../Spectra/AncestorFlags.hh"
 #include <math.h>
 #include <iostream>
 #include <string>
@@ -28,16 +31,6 @@ namespace Rivet {
     /// Constructor
     DEFAULT_RIVET_ANALYSIS_CTOR(PHENIX_2006_I711951);
 
-    bool getDeltaPt(YODA::Histo1D hist, double pT, double &deltaPt)
-    {
-      if(pT > hist.xMin() && pT < hist.xMax())
-      {
-        deltaPt = hist.bin(hist.binIndexAt(pT)).xMid();
-        return true;
-      }
-      else return false;
-
-    }
 //create binShift function
     void binShift(YODA::Histo1D& histogram) {
         std::vector<YODA::HistoBin1D> binlist = histogram.bins();
@@ -71,6 +64,7 @@ namespace Rivet {
     // Alice projection? 
       const ALICE::PrimaryParticles cp(Cuts::absrap < 0.5 && Cuts::pT > 0.5*GeV && Cuts::pT < 9*GeV);
       declare(cp,"cp");
+      declare(AncestorFlags(), "Ancestry");
    
     
       const ParticlePair& beam = beams();
@@ -95,7 +89,7 @@ namespace Rivet {
       else if (beamOpt == "AuAu200") collSys = AuAu200;
       
       if (collSys != pp) {
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
       }
 
 
@@ -201,6 +195,9 @@ namespace Rivet {
       //Invariant Yield in DAu 60-88.5% (p_bar)
       book(hDAu_Yields["P_barC88"], 10,1,8);
 
+      // Invariant-yield fillers, weighted with the pT bin centres
+      yDAu_Yields = invariantYields(hDAu_Yields);
+      yPP_Yields = invariantYields(hPP_Yields);
     }
 
 
@@ -208,6 +205,7 @@ namespace Rivet {
     void analyze(const Event& event) {
       //sow->fill();
       Particles chargedP = applyProjection<PrimaryParticles>(event,"cp").particles();
+      const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
 
       
         
@@ -215,65 +213,27 @@ namespace Rivet {
         sow["sow_pp"]->fill();
         for (const Particle& p :chargedP) {
           double partPt = p.pT() / GeV;
-          double pt_weight = 1. / (partPt*2.*M_PI);
-          double deltaPt = 0.;
 
           if (p.pid() == 211) {
-            if (getDeltaPt(*hPP_Yields["PiplusPP"], partPt, deltaPt))
-            {
-              pt_weight /= deltaPt;
-              hPP_Yields["PiplusPP"]->fill(partPt, pt_weight);
-            }
+            yPP_Yields["PiplusPP"].fill(partPt);
           }
           if (p.pid() == -211) {
-            if (getDeltaPt(*hPP_Yields["PiminusPP"], partPt, deltaPt))
-            {
-              pt_weight /= deltaPt;
-              hPP_Yields["PiminusPP"]->fill(partPt, pt_weight);
-            }
+            yPP_Yields["PiminusPP"].fill(partPt);
           }
           if (p.pid() == 321) {
-            if (getDeltaPt(*hPP_Yields["KplusPP"], partPt, deltaPt))
-            {
-              pt_weight /= deltaPt;
-              hPP_Yields["KplusPP"]->fill(partPt, pt_weight);
-            }
+            yPP_Yields["KplusPP"].fill(partPt);
           }
           if (p.pid() == -321) {
-            if (getDeltaPt(*hPP_Yields["KminusPP"], partPt, deltaPt))
-            {
-              pt_weight /= deltaPt;
-              hPP_Yields["KminusPP"]->fill(partPt, pt_weight);
-            }
+            yPP_Yields["KminusPP"].fill(partPt);
           }
           if (p.pid() == 2212) {
-            if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                 p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                 p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                 p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                 p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                 p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                 p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas                        //Omega-
-                    if (getDeltaPt(*hPP_Yields["PPP"], partPt, deltaPt))
-                    {
-                      pt_weight /= deltaPt;
-                      hPP_Yields["PPP"]->fill(partPt, pt_weight);
-                    }
+            if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                    yPP_Yields["PPP"].fill(partPt);
                   }
           }
           if (p.pid() == -2212) {
-            if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                 p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                 p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                 p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                 p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                 p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                 p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas
-                    if (getDeltaPt(*hPP_Yields["P_barPP"], partPt, deltaPt))
-                    {
-                      pt_weight /= deltaPt;
-                      hPP_Yields["P_barPP"]->fill(partPt, pt_weight);
-                    }
+            if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                    yPP_Yields["P_barPP"].fill(partPt);
                   }
           }
         }
@@ -290,65 +250,27 @@ namespace Rivet {
           sow["sow_DAu20"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (partPt*2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hDAu_Yields["PiplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["PiplusC20"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["PiplusC20"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hDAu_Yields["PiminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["PiminusC20"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["PiminusC20"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hDAu_Yields["KplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["KplusC20"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["KplusC20"].fill(partPt);
             }
             if (p.pid() == -321) {
-              if (getDeltaPt(*hDAu_Yields["KminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["KminusC20"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["KminusC20"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                   p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                   p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                   p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                   p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                   p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                   p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas
-                      if (getDeltaPt(*hDAu_Yields["PC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hDAu_Yields["PC20"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yDAu_Yields["PC20"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                   p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                   p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                   p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                   p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                   p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                   p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas
-                      if (getDeltaPt(*hDAu_Yields["P_barC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hDAu_Yields["P_barC20"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yDAu_Yields["P_barC20"].fill(partPt);
                     }
             }
           }
@@ -359,65 +281,27 @@ namespace Rivet {
           sow["sow_DAu40"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (partPt*2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hDAu_Yields["PiplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["PiplusC40"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["PiplusC40"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hDAu_Yields["PiminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["PiminusC40"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["PiminusC40"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hDAu_Yields["KplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["KplusC40"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["KplusC40"].fill(partPt);
             }
             if (p.pid() == -321) {
-              if (getDeltaPt(*hDAu_Yields["KminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["KminusC40"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["KminusC40"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                   p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                   p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                   p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                   p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                   p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                   p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas
-                      if (getDeltaPt(*hDAu_Yields["PC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hDAu_Yields["PC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yDAu_Yields["PC40"].fill(partPt);
               }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                   p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                   p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                   p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                   p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                   p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                   p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas
-                      if (getDeltaPt(*hDAu_Yields["P_barC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hDAu_Yields["P_barC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yDAu_Yields["P_barC40"].fill(partPt);
               }
             }
           }
@@ -429,65 +313,27 @@ namespace Rivet {
           sow["sow_DAu60"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (partPt*2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hDAu_Yields["PiplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["PiplusC60"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["PiplusC60"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hDAu_Yields["PiminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["PiminusC60"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["PiminusC60"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hDAu_Yields["KplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["KplusC60"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["KplusC60"].fill(partPt);
             }
             if (p.pid() == -321) {
-              if (getDeltaPt(*hDAu_Yields["KminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["KminusC60"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["KminusC60"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                   p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                   p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                   p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                   p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                   p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                   p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas
-                      if (getDeltaPt(*hDAu_Yields["PC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hDAu_Yields["PC60"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yDAu_Yields["PC60"].fill(partPt);
               }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                   p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                   p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                   p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                   p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                   p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                   p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas
-                      if (getDeltaPt(*hDAu_Yields["P_barC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hDAu_Yields["P_barC60"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yDAu_Yields["P_barC60"].fill(partPt);
               }
             }
           }
@@ -498,65 +344,27 @@ namespace Rivet {
           sow["sow_DAu88"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (partPt*2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hDAu_Yields["PiplusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["PiplusC88"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["PiplusC88"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hDAu_Yields["PiminusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["PiminusC88"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["PiminusC88"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hDAu_Yields["KplusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["KplusC88"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["KplusC88"].fill(partPt);
             }
             if (p.pid() == -321) {
-              if (getDeltaPt(*hDAu_Yields["KminusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hDAu_Yields["KminusC88"]->fill(partPt, pt_weight);
-              }
+              yDAu_Yields["KminusC88"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                   p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                   p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                   p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                   p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                   p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                   p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas
-                      if (getDeltaPt(*hDAu_Yields["PC88"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hDAu_Yields["PC88"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yDAu_Yields["PC88"].fill(partPt);
               }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(-3122) || // Lambda, Anti-Lambda
-                   p.hasAncestor(3212) || p.hasAncestor(-3212) || // Sigma0
-                   p.hasAncestor(3222) || p.hasAncestor(-3222) || // Sigmas
-                   p.hasAncestor(3112) || p.hasAncestor(-3112) || // Sigmas
-                   p.hasAncestor(3322) || p.hasAncestor(-3322) || // Cascades
-                   p.hasAncestor(3312) || p.hasAncestor(-3312) || // Cascades
-                   p.hasAncestor(3334) || p.hasAncestor(-3334))) { // Omegas 
-                      if (getDeltaPt(*hDAu_Yields["P_barC88"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hDAu_Yields["P_barC88"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yDAu_Yields["P_barC88"].fill(partPt);
               }
             }
           }
@@ -733,7 +541,9 @@ namespace Rivet {
     /// @name Histograms
     ///@{
     map<string, Histo1DPtr> hDAu_Yields;
+    map<string, InvariantYield> yDAu_Yields;
     map<string, Histo1DPtr> hPP_Yields;
+    map<string, InvariantYield> yPP_Yields;
 
     map<string, CounterPtr> sow;
     string beamOpt;
@@ -13,6 +13,7 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 #include <math.h>
 #include <fstream>
 #include <iostream>
@@ -89,7 +90,9 @@ namespace Rivet {
           else if (beamOpt == "DAU200") collSys = DAu200;
 
           //declaration for collision systems that are not p+p
-          if (!(collSys == pp)) declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+          if (!(collSys == pp)) {
+            DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
+          }
 
           //Counters
           book(sow["sow_pp"], "_sow_pp");
@@ -12,6 +12,7 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh" //external header for Centrality calculation
+#include "../Centralities/CentralityTable.hh"
 #include <math.h>
 #include <fstream>
 #include <iostream>
@@ -46,7 +47,9 @@ namespace Rivet {
 	else if (beamOpt == "AUAU200") collSys = AuAu200;
 	else if (beamOpt == "dAU200") collSys = dAu200;
 	
-	if (!(collSys == pp)) declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+	if (!(collSys == pp)) {
+		DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
+	}
 
 	//Create various counters
 	book(sow["sow_pp"], "sow_pp");
@@ -7,6 +7,7 @@
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 //#include <math.h>
 //#define _USE_MATH_DEFINES
 
@@ -33,7 +34,9 @@ namespace Rivet {
       if(beamOpt=="PP200") CollSys = pp200;
       else if(beamOpt=="CUCU200") CollSys = CuCu200;
      
-      if(!(CollSys == pp200)) declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      if (!(CollSys == pp200)) {
+        DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
+      }
 
       //declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
 
@@ -4,6 +4,9 @@
 #include "Rivet/Projections/UnstableParticles.hh"
 #include "Rivet/Tools/Cuts.hh"
 #include "../Centralities/RHICCentrality.hh" //external header for Centrality calculation
+#include "../Centralities/CentralityTable.hh"
+#include "../Centralities/SelfCalibratingCentrality.hh"
+#include "../Centralities/Glauber.hh"
 #include <math.h>
 #define _USE_MATH_DEFINES
 
@@ -51,7 +54,15 @@ namespace Rivet {
       const UnstableParticles pi0(Cuts::absrap < 0.35 && Cuts::pT > 1*GeV && Cuts::abspid == 111 );
       declare(pi0, "pi0");
 
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      // selfcal=N: calibrate the centrality on the first (at most N) Au+Au
+      // events of this run instead of a separate calibration run
+      const int selfCal = getOption<int>("selfcal", 0);
+      if(selfCal > 0)
+      {
+        _selfCent = make_shared<SelfCalibratingCentrality>(selfCal/10, selfCal);
+        declare(RHICCentrality("PHENIX"), "CEST");
+      }
+      else DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
       string refnameRaa = mkAxisCode(1,1,1);
       const Scatter2D& refdataRaa =refData(refnameRaa);
@@ -91,8 +102,26 @@ namespace Rivet {
           return;
       }
 
-      const CentralityProjection& cent = apply<CentralityProjection>(event,"CMULT");
-      const double c = cent();
+      double c = 0.;
+      if(_selfCent)
+      {
+          const double est = apply<RHICCentrality>(event, "CEST")();
+          if(!_selfCent->calibrated())
+          {
+              // Warm-up: keep the pi0 pTs, filled once the table is frozen
+              vector<float> pts;
+              for(const Particle& p : neutralParticles) pts.push_back(p.pT()/GeV);
+              const auto& weights = event.weights();
+              if(_selfCent->buffer(est, vector<double>(std::begin(weights), std::end(weights)), pts)) replayWarmUp();
+              return;
+          }
+          c = _selfCent->percentile(est);
+      }
+      else
+      {
+          const CentralityProjection& cent = apply<CentralityProjection>(event,"CMULT");
+          c = cent();
+      }
 
       if (c > 5.) vetoEvent;
       sow["sow_AuAu"]->fill();
@@ -105,14 +134,34 @@ namespace Rivet {
 
     }
 
+    /// Fill the warm-up events of the self-calibrated centrality. Each
+    /// enters the raw histogram of every weight stream with its own weight.
+    void replayWarmUp() {
+      _selfCent->replay([&](double c, const double* w, const float* pts, size_t n) {
+          if (c > 5.) return;
+          for(size_t iw = 0; iw < _selfCent->numWeights(); iw++)
+          {
+              sow["sow_AuAu"].get()->persistent(iw)->fill(w[iw]);
+              for(size_t i = 0; i < n; i++) hPion0Pt["Pion0Pt_AuAu"].get()->persistent(iw)->fill(pts[i], w[iw]);
+          }
+      });
+    }
+
     void finalize() {
+      if(_selfCent && !_selfCent->calibrated())
+      {
+          MSG_WARNING("selfcal: the centrality warm-up did not finish, "
+                      << _selfCent->numBuffered() << " Au+Au events were not filled");
+      }
+
       binShift(*hPion0Pt["Pion0Pt_AuAu"]);
       binShift(*hPion0Pt["Pion0Pt_pp"]);
       hPion0Pt["Pion0Pt_AuAu"]->scaleW(1./sow["sow_AuAu"]->sumW());
       hPion0Pt["Pion0Pt_pp"]->scaleW(1./sow["sow_pp"]->sumW());
 
       divide(hPion0Pt["Pion0Pt_AuAu"],hPion0Pt["Pion0Pt_pp"],hRaa);
-      hRaa->scaleY(1./1051.3);
+      // <N_coll> of 0-5% Au+Au from the MC Glauber model
+      hRaa->scaleY(1./Glauber::get("AuAu", Glauber::sigmaNN(200.)).ncoll(0., 5.));
 
     }
 
@@ -122,6 +171,7 @@ namespace Rivet {
     enum CollisionSystem {pp, AuAu200};
     CollisionSystem collSys;
     string beamOpt;
+    shared_ptr<SelfCalibratingCentrality> _selfCent;
 
   };
 
@@ -4,3 +4,5 @@ export RIVET_ANALYSIS_PATH=$PWD
 rivet-buildplugin RivetPHENIX_2008_I777211.so PHENIX_2008_I777211.cc
 rivet-merge -o Angantyr.yoda -O beam Angantyr_AuAu_200GeV.yoda Angantyr_pp_200GeV.yoda
  
+#Or both runs and the merge in one process (../tools/rivetStreams.cc):
+#rivetStreams --pwd -p calibration_PHENIX_AuAu200GeV.yoda -a PHENIX_2008_I777211:cent=GEN -o Angantyr.yoda -s beam=AUAU200 $SIMULATION_DIR_200/hepmc_AuAu_200GeV_*.hepmc -s beam=PP200 $SIMULATION_DIR_PP/hepmc_pp_200GeV_*.hepmc
@@ -18,6 +18,7 @@
 #include "Rivet/Projections/UnstableParticles.hh"
 
 #include "../Centralities/RHICCentrality.hh" //external header for Centrality calculation
+#include "../Centralities/CentralityTable.hh"
 #include <math.h>
 #define _USE_MATH_DEFINES
 
@@ -90,7 +91,9 @@ namespace Rivet {
       //if(beamOpt=="PP") collSys = pp;
       //else if(beamOpt=="AUAU") collSys = AuAu;
 
-     if(!(collSys == pp)) declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+     if (!(collSys == pp)) {
+       DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
+     }
 
 
  //Yields_________________
@@ -12,35 +12,39 @@
 #include <math.h>
 #include <vector>
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Centralities/Glauber.hh"
+#include "../Spectra/Binning.hh"
 
 #define _USE_MATH_DEFINES
-static const int numTrigPtBins = 4;
-static const float pTTrigBins[] = {2.0,3.0,4.0,5.0,10.0};
-static const int numAssocPtBins = 6;
-static const float pTAssocBins[] = {0.4,1.0,2.0,3.0,4.0,5.0,10.0};
-static const int numCentBins = 5;
-static const float CentBins[] = {0.0,12.0,20.0,40.0,60.0,92.0};
-static const int numDeltaPhiBins = 26;
-static const float DeltaPhiBins[] = {-1.5048,-1.275,-0.98,-0.685,-0.415,-0.22,-0.1,0,0.1,0.22,0.415,0.685,0.98,
-1.275,1.595,1.965,2.305,2.55,2.75,2.945,3.14,3.44,3.535,3.73,3.935,4.32,4.7012};
-static const int numpTAssocBins2 = 4;
-static const float pTAssocBins2[] = {1.0,1.5,2.0,2.5,3.0};
+using Rivet::makeBinning;
+
+static constexpr auto pTTrigBins = makeBinning(2.0,3.0,4.0,5.0,10.0);
+static constexpr int numTrigPtBins = pTTrigBins.size();
+static constexpr auto pTAssocBins = makeBinning(0.4,1.0,2.0,3.0,4.0,5.0,10.0);
+static constexpr int numAssocPtBins = pTAssocBins.size();
+static constexpr auto CentBins = makeBinning(0.0,12.0,20.0,40.0,60.0,92.0);
+static constexpr int numCentBins = CentBins.size();
+static constexpr auto DeltaPhiBins = makeBinning(-1.5048,-1.275,-0.98,-0.685,-0.415,-0.22,-0.1,0,0.1,0.22,0.415,0.685,0.98,
+1.275,1.595,1.965,2.305,2.55,2.75,2.945,3.14,3.44,3.535,3.73,3.935,4.32,4.7012);
+static constexpr int numDeltaPhiBins = DeltaPhiBins.size();
+static constexpr auto pTAssocBins2 = makeBinning(1.0,1.5,2.0,2.5,3.0);
+static constexpr int numpTAssocBins2 = pTAssocBins2.size();
 //For figure 12
-static const int numCentBins12 = 4;
-static const float CentBins12[] = {0.0,20.0,40.0,60.0,92.0};
-static const int numpTAssocBins12 = 8;
-static const float pTAssocBins12[] = {0.345,0.915,1.415,1.915,2.415,3.055,4.095,5.285,5.88};
+static constexpr auto CentBins12 = makeBinning(0.0,20.0,40.0,60.0,92.0);
+static constexpr int numCentBins12 = CentBins12.size();
+static constexpr auto pTAssocBins12 = makeBinning(0.345,0.915,1.415,1.915,2.415,3.055,4.095,5.285,5.88);
+static constexpr int numpTAssocBins12 = pTAssocBins12.size();
 //For figure 25 
-static const int numCentBins25 = 10;
-static const float CentBins25[] = {0.0,5.0,10.0,20.0,30.0,40.04,50.0,60.0,70.0,92.0,100};
+static constexpr auto CentBins25 = makeBinning(0.0,5.0,10.0,20.0,30.0,40.04,50.0,60.0,70.0,92.0,100);
+static constexpr int numCentBins25 = CentBins25.size();
 
 //For figure 26 
-static const int numCentBins26 = 5;
-static const float CentBins26[] = {0.0,20.0,40.0,60.0,70.0,92.0};
+static constexpr auto CentBins26 = makeBinning(0.0,20.0,40.0,60.0,70.0,92.0);
+static constexpr int numCentBins26 = CentBins26.size();
 
-static const int numCentBins31 = 4;
-static const float CentBins31[] = {0,20,40,60,92};
-static const float Ncoll[] = {779,297,90.6,14.5};
+static constexpr auto CentBins31 = makeBinning(0,20,40,60,92);
+static constexpr int numCentBins31 = CentBins31.size();
 
 using namespace std;
 
@@ -298,20 +302,6 @@ namespace Rivet {
       }
 
    
-      bool isSecondary(Particle p)
-      {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-          p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-          p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-          p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-          p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-          p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-          p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-          return true;
-        else return false;
-       
-      }
     double CalculateVn(YODA::Histo1D& hist, int nth)
     {
         int nBins = hist.numBins();
@@ -425,7 +415,9 @@ namespace Rivet {
         if (beamOpt == "PP") collSys = pp0;
         else if (beamOpt == "AUAU") collSys = AuAu;
         
-        if (!(collSys == pp0)) declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+        if (!(collSys == pp0)) {
+          DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
+        }
 
 
       int pta;
@@ -1688,8 +1680,9 @@ for(Correlator& corr : Correlators4)
 
      for(const Particle& pTrig : cfs.particles())
      {
-         //Check if is secondary    FIXME, omitted for run time 
-         //if(isSecondary(pAssoc)) continue;
+         //All trigger ranges lie within pTTrigBins: skip the correlator loops for softer particles
+         if(!pTTrigBins.contains(pTrig.pt()/GeV)) continue;
+
           
          //Trigger counting Figure 38
          for(Correlator& corr : Correlators38)
@@ -1870,8 +1863,6 @@ for(Correlator& corr : Correlators4)
               //Check if Trigger and Associated are the same particle
               if(isSameParticle(pTrig,pTAssoc)) continue; //I changed this FIXME
                 
-              //Check if is secondary
-              //if(isSecondary(pAssoc)) continue;
               
             //*****************************************************************************
             // The following will fill the histograms for Figure 38 
@@ -2226,6 +2217,11 @@ for(Correlator& corr : Correlators4)
 
     void finalize() {
 
+      // <N_coll> of the Fig. 31 classes from the MC Glauber model
+      const Glauber& glauber = Glauber::get("AuAu", Glauber::sigmaNN(200.));
+      vector<double> Ncoll;
+      for(int i = 0; i < numCentBins31; i++) Ncoll.push_back(glauber.ncoll(CentBins31[i], CentBins31[i+1]));
+
       bool AuAu200_available = false;
       bool pp_available = false;
 
@@ -10,6 +10,8 @@
 #include <math.h>
 #include <vector> 
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/AncestorFlags.hh"
 
 #define _USE_MATH_DEFINES
 
@@ -126,21 +128,6 @@ namespace Rivet {
         return true;
     }
     
-    bool isSecondary(Particle p)
-    {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-	           p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-	           p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-	           p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-	           p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-	           p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-	           p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-        return true;
-        else return false;
-        
-    }
-	
 	double CalculateVn(YODA::Histo1D& hist, int nth)
     {
         int nBins = hist.numBins();
@@ -283,6 +270,7 @@ namespace Rivet {
 
       const ChargedFinalState cfs(Cuts::abseta < 5 && Cuts::pT > 100*MeV);
       declare(cfs, "CFS");
+      declare(AncestorFlags(), "Ancestry");
 	  
 	  const ChargedFinalState cfsTrig(Cuts::abseta < 1.0 && Cuts::pT > 2*GeV);
       declare(cfsTrig, "CFSTrig");
@@ -290,7 +278,7 @@ namespace Rivet {
       // Declare centrality projection
 	  
 	  //Later Fix to Use STAR(/PHENIX)?
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 	  
 	  //==================================================
       // Create one correlator for each set of Collisions System / Beam Energy / Centrality Interval / Trigger pT interval / Associated pT interval
@@ -699,6 +687,8 @@ namespace Rivet {
     }
     
     if(isVeto) vetoEvent;
+
+    const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
     
     // loop over charged final state particles
       for(const Particle& pTrig : cfsTrig.particles()) {
@@ -706,7 +696,7 @@ namespace Rivet {
 	       if(pTrig.pt()/GeV < triggerptMin || pTrig.pt()/GeV > triggerptMax) continue;
 
           //Check if is secondary
-          if(isSecondary(pTrig)) continue;
+          if(ancestry.isSecondary(pTrig)) continue;
           
 		  if( abs(pTrig.pid())==211 || abs(pTrig.pid())==2212 || abs(pTrig.pid())==321){
 
@@ -724,7 +714,7 @@ namespace Rivet {
                 if(isSameParticle(pTrig,pAssoc)) continue;
                 
                 //Check if is secondary
-                if(isSecondary(pAssoc)) continue;
+                if(ancestry.isSecondary(pAssoc)) continue;
                 
 			  if( abs(pAssoc.pid())==211 || abs(pAssoc.pid())==2212 || abs(pAssoc.pid())==321){
 			    //int mybin = GetTrigBin(pTrig.pt());
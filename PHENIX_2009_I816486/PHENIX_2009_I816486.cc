@@ -11,6 +11,8 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh" //external header for Centrality calculation
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/Binning.hh"
 #include <math.h>
 #include <fstream>
 #include <iostream>
@@ -19,6 +21,10 @@
 
 namespace Rivet {
 
+  // Centrality classes of the R_AA, named by their upper edge (c10pt_AuAu200 is 0-10%)
+  static constexpr auto RaaCentBins = makeBinning(0, 10, 20, 30, 40, 50, 60);
+  static constexpr size_t NRAACENT = RaaCentBins.size();
+
 
   /// @brief Add a short analysis description here
   class PHENIX_2009_I816486 : public Analysis {
@@ -39,7 +45,9 @@ namespace Rivet {
       else if(beamOpt=="AUAU200") collSys = AuAu200;
 
 
-      if(!(collSys == pp)) declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      if (!(collSys == pp)) {
+        DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
+      }
 
 
 
@@ -48,9 +56,9 @@ namespace Rivet {
       book(hPion0Pt["ptv2c0005"], 1, 1, 1);
       book(hPion0Pt["ptv2c0510"], 1, 1, 2);
 
-      for(int i = 0, N = CentralityBins.size();i < N-2; ++i)
+      for(size_t i = 0; i < NRAACENT; ++i)
       {
-        book(hPion0Pt["ptv2c" + std::to_string(CentralityBins[i+2])], 1, 1, i+3);
+        book(hPion0Pt["ptv2c" + std::to_string(int(RaaCentBins.high(i)))], 1, 1, i+3);
       }
 
       book(hPion0Pt["ptv2c0020"], 2, 1, 1);
@@ -60,15 +68,16 @@ namespace Rivet {
 
 
       //RAA _______________________________
-      for(int i = 0, N = CentralityBins.size();i < N-2; ++i)
+      for(size_t i = 0; i < NRAACENT; ++i)
       {
+        const string cl = std::to_string(int(RaaCentBins.high(i)));
         string refnameRaa=mkAxisCode(3,1,i+1);
         const Scatter2D& refdataRaa =refData(refnameRaa);
-        book(hPion0Pt["c" + std::to_string(CentralityBins[i+2]) + "pt_AuAu200"], refnameRaa + "_AuAu200", refdataRaa);
-        book(hPion0Pt["c" + std::to_string(CentralityBins[i+2]) + "pt_pp"], refnameRaa + "_pp", refdataRaa);
-        book(hRaa["Raa" + std::to_string(CentralityBins[i+2])], refnameRaa);
+        book(hPtAuAu[i], refnameRaa + "_AuAu200", refdataRaa);
+        book(hPtpp[i], refnameRaa + "_pp", refdataRaa);
+        book(hRaa["Raa" + cl], refnameRaa);
 
-        book(sow["sow_c" + std::to_string(CentralityBins[i+2])],"sow_c" + std::to_string(CentralityBins[i+2]));
+        book(sowCent[i],"sow_c" + cl);
       }
 
         book(sow["sow_pp"],"sow_pp");
@@ -80,12 +89,12 @@ namespace Rivet {
 
       for(int j = 0, N = PtBins.size();j < N; ++j)
       {
-        for(int i = 0, M = CentralityBins.size();i < M-3; ++i)
+        for(int i = 0, M = NRAACENT;i < M-1; ++i)
         {
           h=i+(j*5);
           string refnameRaa = mkAxisCode(4,1,h+1);
           const Scatter2D& refdataRaa =refData(refnameRaa);
-          book(hRaadphi["Raa_c"+ std::to_string(CentralityBins[i+3]) + "_pt" + std::to_string(PtBins[j]) + std::to_string(PtBins[j+1]) + "_AuAu200"], refnameRaa, refdataRaa);
+          book(hRaadphi["Raa_c"+ std::to_string(int(RaaCentBins.high(i+1))) + "_pt" + std::to_string(PtBins[j]) + std::to_string(PtBins[j+1]) + "_AuAu200"], refnameRaa, refdataRaa);
         }
       }
     }
@@ -96,13 +105,10 @@ namespace Rivet {
             if(collSys==pp)
             {
               sow["sow_pp"]->fill();
-              for(Particle p : neutralParticles)
+              //The pp reference enters the R_AA of every centrality class
+              for(const Histo1DPtr& h : hPtpp)
               {
-                for(int i = 0, N = CentralityBins.size();i < N-2; ++i)
-                {
-                  hPion0Pt["c" + std::to_string(CentralityBins[i+2]) + "pt_pp"]->fill(p.pT()/GeV);
-                }
-
+                for(const Particle& p : neutralParticles) h->fill(p.pT()/GeV);
               }
               return;
             }
@@ -114,69 +120,11 @@ namespace Rivet {
 
             if (collSys==AuAu200)
             {
-                if((c >= 0.) && (c < 5.))
-                {
-                    for(const Particle& p : neutralParticles)
-                    {
-                        double partPt = p.pT()/GeV;
-
-                        hPion0Pt["c10pt_AuAu200"]->fill(partPt);
-                    }
-                }
-                else if((c >= 5.) && (c < 10.))
-                {
-                    for(const Particle& p : neutralParticles)
-                    {
-                        double partPt = p.pT()/GeV;
-
-                        hPion0Pt["c10pt_AuAu200"]->fill(partPt);
-                    }
-                }
-                else if((c >= 10.) && (c < 20.))
-                {
-                    for(const Particle& p : neutralParticles)
-                    {
-                        double partPt = p.pT()/GeV;
-
-                        hPion0Pt["c20pt_AuAu200"]->fill(partPt);
-                    }
-                }
-                else if((c >= 20.) && (c < 30.))
-                {
-                    for(const Particle& p : neutralParticles)
-                    {
-                        double partPt = p.pT()/GeV;
-
-                        hPion0Pt["c30pt_AuAu200"]->fill(partPt);
-                    }
-                }
-                else if((c >= 30.) && (c < 40.))
-                {
-                    for(const Particle& p : neutralParticles)
-                    {
-                        double partPt = p.pT()/GeV;
-
-                        hPion0Pt["c40pt_AuAu200"]->fill(partPt);
-                    }
-                }
-                else if((c >= 40.) && (c < 50.))
-                {
-                    for(const Particle& p : neutralParticles)
-                    {
-                        double partPt = p.pT()/GeV;
-
-                        hPion0Pt["c50pt_AuAu200"]->fill(partPt);
-                    }
-                }
-                else if((c >= 50.) && (c < 60.))
-                {
-                    for(const Particle& p : neutralParticles)
-                    {
-                        double partPt = p.pT()/GeV;
-
-                        hPion0Pt["c60pt_AuAu200"]->fill(partPt);
-                    }
-                }
+                const int ic = RaaCentBins.index(c);
+                if(ic < 0) return;
+
+                sowCent[ic]->fill();
+                for(const Particle& p : neutralParticles) hPtAuAu[ic]->fill(p.pT()/GeV);
 
                 return;
             }
@@ -194,10 +142,10 @@ namespace Rivet {
 
       //RAA _______________________________
 
-      for(int i = 0, N = CentralityBins.size();i < N-2; ++i)
+      for(size_t i = 0; i < NRAACENT; ++i)
       {
-        hPion0Pt["c" + std::to_string(CentralityBins[i+2]) + "pt_AuAu200"]->scaleW(1./sow["sow_c" + std::to_string(CentralityBins[i+2])]->sumW());
-        divide(hPion0Pt["c" + std::to_string(CentralityBins[i+2]) + "pt_AuAu200"],hPion0Pt["c" + std::to_string(CentralityBins[i+2]) + "pt_pp"],hRaa["Raa" + std::to_string(CentralityBins[i+2])]);
+        hPtAuAu[i]->scaleW(1./sowCent[i]->sumW());
+        divide(hPtAuAu[i],hPtpp[i],hRaa["Raa" + std::to_string(int(RaaCentBins.high(i)))]);
       }
 
       //need to be fixed
@@ -217,13 +165,15 @@ namespace Rivet {
 
 
     map<string, Histo1DPtr> hPion0Pt;
+    // pi0 spectra and event counts of the R_AA, by class of RaaCentBins
+    Histo1DPtr hPtAuAu[NRAACENT], hPtpp[NRAACENT];
+    CounterPtr sowCent[NRAACENT];
     map<string, Scatter2DPtr> hRaa;
     map<string, CounterPtr> sow;
     map<string, Scatter2DPtr> hRaadphi;
     string beamOpt;
     enum CollisionSystem {pp, AuAu200};
     CollisionSystem collSys;
-    vector<int> CentralityBins {0, 5, 10, 20, 30, 40, 50, 60};
     vector<double> PtBins {1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0};
 
   };
@@ -6,6 +6,7 @@
 #include "Rivet/Projections/DressedLeptons.hh"
 #include "Rivet/Projections/FinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 #include <math.h>
 #include <iostream>
 #define _USE_MATH_DEFINES
@@ -31,7 +32,7 @@ namespace Rivet {
 			const UnstableParticles up((Cuts::abspid == 221 || Cuts::abspid == 111) && Cuts::abseta < .35);
 			declare(up, "up");
 
-			declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+			DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 		
 			//____Counters____
 			
@@ -12,6 +12,7 @@
 #include <math.h>
 #include <vector>
 #include "../Centralities/RHICCentrality.hh"
+#include "../Spectra/AncestorFlags.hh"
 #define _USE_MATH_DEFINES
 static const int numTrigPtBins = 4;
 static const float pTTrigBins[] = {5.0,7.0,9.0,12.0,15.0};
@@ -154,21 +155,6 @@ namespace Rivet {
         return true;
       }
     
-      bool isSecondary(Particle p)
-      {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-          p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-          p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-          p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-          p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-          p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-          p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-          return true;
-        else return false;
-        
-      }
-
     double CalculateVn(YODA::Histo1D& hist, int nth)
     {
         int nBins = hist.numBins();
@@ -352,6 +338,7 @@ namespace Rivet {
         
         const ChargedFinalState cfs(Cuts::abseta < 0.35);
         declare(cfs, "CFS");
+        declare(AncestorFlags(), "Ancestry");
         
         const PrimaryParticles pp(pdgPi0, Cuts::abseta < 0.35);
         declare(pp, "PP");
@@ -505,12 +492,14 @@ namespace Rivet {
       }
     
       if(isVeto) vetoEvent;
+
+      const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
     
     // loop over charged final state particles - PI0
     for(const Particle& pTrig : ppTrigPi0.particles())
     {
         //Check if is secondary
-        if(isSecondary(pTrig)) continue;
+        if(ancestry.isSecondary(pTrig)) continue;
           
         
         for(Correlator& corr : Correlators)
@@ -528,7 +517,7 @@ namespace Rivet {
             if(isSameParticle(pTrig,pAssoc)) continue;
                 
             //Check if is secondary
-            if(isSecondary(pAssoc)) continue;
+            if(ancestry.isSecondary(pAssoc)) continue;
 
             //https://rivet.hepforge.org/code/dev/structRivet_1_1DeltaPhiInRange.html
             double dPhi = deltaPhi(pTrig, pAssoc, true);//this does NOT rotate the delta phi to be in a given range
@@ -565,7 +554,7 @@ namespace Rivet {
     for(const Particle& pTrig : pfsTrigPhotons.particles())
     {
         //Check if is secondary
-        if(isSecondary(pTrig)) continue;
+        if(ancestry.isSecondary(pTrig)) continue;
           
         
         for(Correlator& corr : Correlators)
@@ -583,7 +572,7 @@ namespace Rivet {
             if(isSameParticle(pTrig,pAssoc)) continue;
                 
             //Check if is secondary
-            if(isSecondary(pAssoc)) continue;
+            if(ancestry.isSecondary(pAssoc)) continue;
 
             //https://rivet.hepforge.org/code/dev/structRivet_1_1DeltaPhiInRange.html
             double dPhi = deltaPhi(pTrig, pAssoc, true);//this does NOT rotate the delta phi to be in a given range
@@ -18,6 +18,8 @@
 #include <math.h>
 #include <vector> 
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/AncestorFlags.hh"
 #define _USE_MATH_DEFINES
 
 using namespace std;
@@ -143,20 +145,6 @@ namespace Rivet {
         return true;
       }
     
-      bool isSecondary(Particle p)
-      {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-          p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-          p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-          p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-          p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-          p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-          p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-          return true;
-        else return false;    
-      }
-
       void init() {
 
          // Initialise and register projections
@@ -190,10 +178,11 @@ namespace Rivet {
         // the basic final-state projection: all final-state particles within the given eta acceptance
         const ChargedFinalState cfs(Cuts::pT > 1*GeV); //Not cutting in eta, so no need to correct for pair acceptance
         declare(cfs, "CFS");
+        declare(AncestorFlags(), "Ancestry");
         const ChargedFinalState cfsTrig(Cuts::abseta < 1.0 && Cuts::pT > 2*GeV);
         declare(cfsTrig, "CFSTrig");
         
-        declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+        DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
         //==================================================
         // Create a correlator for each histogram. A different correlator must be created for each beam, centrality, and range.
@@ -387,12 +376,14 @@ namespace Rivet {
         }
         
         if (isVeto) vetoEvent;
+
+        const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
         
         // loop over charged final state particles
         for (const Particle& pTrig : cfsTrig.particles()) {
         
           if (pTrig.pt()/GeV < triggerptMin || pTrig.pt()/GeV > triggerptMax) continue;
-          if (isSecondary(pTrig)) continue;
+          if (ancestry.isSecondary(pTrig)) continue;
           
           // https://home.fnal.gov/~mrenna/lutp0613man2/node44.html
           // 211 = pi+, 2212 = p+, 321 = K+
@@ -406,7 +397,7 @@ namespace Rivet {
             for (const Particle& pAssoc : cfs.particles()) {
               if(pAssoc.pt()/GeV < associatedptMin || pAssoc.pt()/GeV > pTrig.pt()/GeV) continue;
               if(isSameParticle(pTrig,pAssoc)) continue;
-              if(isSecondary(pAssoc)) continue;
+              if(ancestry.isSecondary(pAssoc)) continue;
               
               if(abs(pAssoc.pid()) == 211 || abs(pAssoc.pid()) == 2212 || abs(pAssoc.pid()) == 321) {
 
@@ -7,6 +7,7 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "Rivet/Tools/AliceCommon.hh"
+#include "../Spectra/InvariantYield.hh"
 
 namespace Rivet {
 
@@ -44,17 +45,6 @@ namespace Rivet {
         }
     }
 
-    // Function to get bin centers for scaling
-    bool getDeltaPt(YODA::Histo1D hist, double pT, double &deltaPt)
-    {
-        if(pT > hist.xMin() && pT < hist.xMax())
-        {
-        	deltaPt = hist.bin(hist.binIndexAt(pT)).xMid();
-                return true;
-        }
-        else return false;
-    }
-
     /// @name Analysis methods
     //@{
 
@@ -110,6 +100,9 @@ namespace Rivet {
       book(_c["xsec_pp200"], "xsec_pp200");
       book(_c["xsec_pp62"], "xsec_pp62");
 
+      // Invariant-yield fillers, weighted with the pT bin centres, |eta| < 0.35
+      _y = invariantYields(_h, 0.7);
+
     }
 
 
@@ -158,8 +151,6 @@ namespace Rivet {
       for( const Particle& pPI : fsPIParticles)
       {
 	      	double PtPI = pPI.pT()/GeV;
-                double PtPI_weight = 1./(2.*M_PI*0.7);
-                double deltaPtPI = 0;
 
 		// Fill histos 200GeV
 
@@ -169,47 +160,18 @@ namespace Rivet {
 		{
 
 
-			if(getDeltaPt(*_h["xsec_piplus_200"],PtPI,deltaPtPI))
-			{
-      				if(pPI.pid() == 211)
-              {
-                PtPI_weight /= deltaPtPI;
-                _h["xsec_piplus_200"]->fill(pPI.pT()/GeV, PtPI_weight);
-              }
-			}
+			if(pPI.pid() == 211) _y["xsec_piplus_200"].fill(PtPI);
 
-			if(getDeltaPt(*_h["xsec_piminus_200"],PtPI,deltaPtPI))
-			{
-				if(pPI.pid() == -211)
-        {
-          PtPI_weight /= deltaPtPI;
-          _h["xsec_piminus_200"]->fill(pPI.pT()/GeV, PtPI_weight);
-        }
-			}
+			if(pPI.pid() == -211) _y["xsec_piminus_200"].fill(PtPI);
 		}
 
 		// Fill histos 62.4GeV
 		if (collsys == pp62)
                 {
 
-			if(getDeltaPt(*_h["xsec_piplus_62"],PtPI,deltaPtPI))
-			{
-                		if(pPI.pid() == 211)
-                    {
-                      PtPI_weight /= deltaPtPI;
-                      _h["xsec_piplus_62"]->fill(pPI.pT()/GeV, PtPI_weight);
-                    }
-			}
-
-			if(getDeltaPt(*_h["xsec_piminus_62"],PtPI,deltaPtPI))
-			{
-
-                		if(pPI.pid() == -211)
-                    {
-                      PtPI_weight /= deltaPtPI;
-                      _h["xsec_piminus_62"]->fill(pPI.pT()/GeV, PtPI_weight);
-                    }
-			}
+			if(pPI.pid() == 211) _y["xsec_piplus_62"].fill(PtPI);
+
+			if(pPI.pid() == -211) _y["xsec_piminus_62"].fill(PtPI);
 		}
 
       }
@@ -218,57 +180,23 @@ namespace Rivet {
       for( const Particle& pK : fsKParticles)
       {
                 double PtK = pK.pT()/GeV;
-                double PtK_weight = 1./(2.*M_PI*0.7);
-                double deltaPtK = 0;
 
 		// Fill histos 200GeV
 		if (collsys == pp200)
 		{
 
-                        if(getDeltaPt(*_h["xsec_kplus_200"],PtK,deltaPtK))
-                        {
-
-                		if(pK.pid() == 321)
-                    {
-                      PtK_weight /= deltaPtK;
-                      _h["xsec_kplus_200"]->fill(pK.pT()/GeV, PtK_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_kminus_200"],PtK,deltaPtK))
-                        {
-
-                		if(pK.pid() == -321)
-                    {
-                      PtK_weight /= deltaPtK;
-                      _h["xsec_kminus_200"]->fill(pK.pT()/GeV, PtK_weight);
-                    }
-			}
+                        if(pK.pid() == 321) _y["xsec_kplus_200"].fill(PtK);
+
+                        if(pK.pid() == -321) _y["xsec_kminus_200"].fill(PtK);
 		}
 
 		// Fill histos 62.4GeV
 		if (collsys == pp62)
 		{
 
-                        if(getDeltaPt(*_h["xsec_kplus_62"],PtK,deltaPtK))
-                        {
-
-                		if(pK.pid() == 321)
-                    {
-                      PtK_weight /= deltaPtK;
-                      _h["xsec_kplus_62"]->fill(pK.pT()/GeV, PtK_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_kminus_62"],PtK,deltaPtK))
-                        {
-
-                		if(pK.pid() == -321)
-                    {
-                      PtK_weight /= deltaPtK;
-                      _h["xsec_kminus_62"]->fill(pK.pT()/GeV, PtK_weight);
-                    }
-			}
+                        if(pK.pid() == 321) _y["xsec_kplus_62"].fill(PtK);
+
+                        if(pK.pid() == -321) _y["xsec_kminus_62"].fill(PtK);
 		}
 
       }
@@ -277,137 +205,39 @@ namespace Rivet {
       for( const Particle& pP : fsPParticles)
       {
                 double PtP = pP.pT()/GeV;
-                double PtP_weight = 1./(2.*M_PI*0.7);
-                double deltaPtP = 0;
 
 		// Fill histos 200GeV
 		if (collsys == pp200)
 		{
 
-                        if(getDeltaPt(*_h["xsec_p_noFD_200_1"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == 2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_p_noFD_200_1"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_p_noFD_200_2"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == 2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_p_noFD_200_2"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_pbar_noFD_200_1"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == -2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_pbar_noFD_200_1"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_pbar_noFD_200_2"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == -2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_pbar_noFD_200_2"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_p_withFD_200_1"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == 2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_p_withFD_200_1"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_p_withFD_200_2"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == 2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_p_withFD_200_2"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_pbar_withFD_200_1"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == -2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_pbar_withFD_200_1"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_pbar_withFD_200_2"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == -2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_pbar_withFD_200_2"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
+                        if(pP.pid() == 2212) _y["xsec_p_noFD_200_1"].fill(PtP);
+
+                        if(pP.pid() == 2212) _y["xsec_p_noFD_200_2"].fill(PtP);
+
+                        if(pP.pid() == -2212) _y["xsec_pbar_noFD_200_1"].fill(PtP);
+
+                        if(pP.pid() == -2212) _y["xsec_pbar_noFD_200_2"].fill(PtP);
+
+                        if(pP.pid() == 2212) _y["xsec_p_withFD_200_1"].fill(PtP);
+
+                        if(pP.pid() == 2212) _y["xsec_p_withFD_200_2"].fill(PtP);
+
+                        if(pP.pid() == -2212) _y["xsec_pbar_withFD_200_1"].fill(PtP);
+
+                        if(pP.pid() == -2212) _y["xsec_pbar_withFD_200_2"].fill(PtP);
 		}
 
 		// Fill histos 62.4GeV
 		if (collsys == pp62)
 		{
 
-                        if(getDeltaPt(*_h["xsec_p_noFD_62"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == 2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_p_noFD_62"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_pbar_noFD_62"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == -2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_pbar_noFD_62"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_p_withFD_62"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == 2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_p_withFD_62"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
-
-                        if(getDeltaPt(*_h["xsec_pbar_withFD_62"],PtP,deltaPtP))
-                        {
-
-                		if(pP.pid() == -2212)
-                    {
-                      PtP_weight /= deltaPtP;
-                      _h["xsec_pbar_withFD_62"]->fill(pP.pT()/GeV, PtP_weight);
-                    }
-			}
+                        if(pP.pid() == 2212) _y["xsec_p_noFD_62"].fill(PtP);
+
+                        if(pP.pid() == -2212) _y["xsec_pbar_noFD_62"].fill(PtP);
+
+                        if(pP.pid() == 2212) _y["xsec_p_withFD_62"].fill(PtP);
+
+                        if(pP.pid() == -2212) _y["xsec_pbar_withFD_62"].fill(PtP);
 		}
 
       }
@@ -487,6 +317,7 @@ namespace Rivet {
     /// @name Histograms
     //@{
     map<string, Histo1DPtr> _h;
+    map<string, InvariantYield> _y;
     map<string, Profile1DPtr> _p;
     map<string, CounterPtr> _c;
     map<string, Scatter2DPtr> _s;
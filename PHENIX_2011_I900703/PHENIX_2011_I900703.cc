@@ -10,6 +10,7 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 const int NCEN = 6; // Centrality : 0-10, 10-20, 20-30, 30-40, 40-50, 50-60\%
 const int NPTB = 2; // Pt : 0.75 - 1.0, 1.75 - 2.0 GeV/$c$
@@ -197,7 +198,7 @@ namespace Rivet {
         beamOpt = getOption<string>("beam", "NONE");
 
         // Declare Centrality
-        declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+        DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
         // Declare Particles in this RIVET Analysis
         // Charged Particles for EP determination and Vn measurements
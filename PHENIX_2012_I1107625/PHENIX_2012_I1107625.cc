@@ -11,6 +11,7 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh" //external header for Centrality calculation
+#include "../Centralities/CentralityTable.hh"
 #include "Rivet/Projections/UnstableParticles.hh"
 #include <math.h>
 #define _USE_MATH_DEFINES
@@ -59,7 +60,7 @@ namespace Rivet {
       const UnstableParticles ufs(Cuts::abseta < 0.35 && Cuts::pT > 0.8*GeV && Cuts::pid == 111);
       declare(ufs, "ufs");
 
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
       //Yields_________________
       book(hPion0Pt["ptyields39c10"], 1, 1, 1);
@@ -6,6 +6,7 @@
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 namespace Rivet {
 
@@ -24,7 +25,7 @@ namespace Rivet {
     /// Book histograms and initialise projections before the run
     void init() {
 
-	  declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+		DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
     beamOpt = getOption<string>("beam", "NONE");
 
 	  //const FinalState fs(Cuts::abseta < 0.5 && Cuts::pT > 0.15*GeV);
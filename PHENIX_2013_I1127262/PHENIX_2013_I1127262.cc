@@ -7,6 +7,7 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "Rivet/Projections/UnstableParticles.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 
 namespace Rivet {
@@ -223,7 +224,7 @@ namespace Rivet {
 
       // Initialise and register projections
 
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
       const FinalState fs(Cuts::pT > 1*GeV && Cuts::abseta < 0.35);
       declare(fs, "fs");
@@ -11,6 +11,8 @@
 #include <math.h>
 #include <vector>
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/AncestorFlags.hh"
 #define _USE_MATH_DEFINES
 
 static const int numDelPhiBins = 10;
@@ -136,21 +138,6 @@ namespace Rivet {
         return true;
     }
     
-    bool isSecondary(Particle p)
-    {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-            p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-            p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-            p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-            p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-            p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-            p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-        return true;
-        else return false;
-        
-    }
-
         double CalculateVn(YODA::Histo1D& hist, int nth)
     {
         int nBins = hist.numBins();
@@ -360,6 +347,7 @@ namespace Rivet {
 
       const ChargedFinalState cfs(Cuts::abseta < 0.35 && Cuts::pT > 0.5*GeV);
       declare(cfs, "CFS");
+      declare(AncestorFlags(), "Ancestry");
       const ChargedFinalState cfsTrig(Cuts::abseta < 0.35 && Cuts::pT > 0.5*GeV);
       declare(cfsTrig, "CFSTrig");
 
@@ -375,7 +363,7 @@ namespace Rivet {
 
       // Declare centrality projection
       // declareCentrality(ALICE::V0MMultiplicity(), "ALICE_2015_PBPBCentrality", "V0M", "V0M");
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
       
        //==================================================
        // Create one correlator for each set of Collisions System / Beam Energy / Centrality Interval / Trigger pT interval / Associated pT interval
@@ -611,6 +599,8 @@ namespace Rivet {
     }
     
     if(isVeto) vetoEvent;
+
+    const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
     
     // loop over charged final state particles
       for(const Particle& pTrig : cfsTrig.particles()) {
@@ -618,7 +608,7 @@ namespace Rivet {
         if(pTrig.pt()/GeV < triggerptMin || pTrig.pt()/GeV > triggerptMax) continue;
 
           //Check if is secondary
-          if(isSecondary(pTrig)) continue;
+          if(ancestry.isSecondary(pTrig)) continue;
           
           if( abs(pTrig.pid())==211 || abs(pTrig.pid())==2212 || abs(pTrig.pid())==321){
 
@@ -636,7 +626,7 @@ namespace Rivet {
                 if(isSameParticle(pTrig,pAssoc)) continue;
                 
                 //Check if is secondary
-                if(isSecondary(pAssoc)) continue;
+                if(ancestry.isSecondary(pAssoc)) continue;
                 
      if( abs(pAssoc.pid())==211 || abs(pAssoc.pid())==2212 || abs(pAssoc.pid())==321){
        //int mybin = GetTrigBin(pTrig.pt());
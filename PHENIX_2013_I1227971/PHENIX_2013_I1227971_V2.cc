@@ -12,6 +12,9 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/InvariantYield.hh"
+#include "../Spectra/AncestorFlags.hh"
 #include <math.h>
 #include <iostream>
 #include <string>
@@ -27,16 +30,6 @@ namespace Rivet {
     /// Constructor
     DEFAULT_RIVET_ANALYSIS_CTOR(PHENIX_2013_I1227971);
 
-    bool getDeltaPt(YODA::Histo1D hist, double pT, double &deltaPt)
-    {
-      if(pT > hist.xMin() && pT < hist.xMax())
-      {
-        deltaPt = hist.bin(hist.binIndexAt(pT)).xMid();
-        return true;
-      }
-      else return false;
-
-    }
 
 
     /// Book histograms and initialise projections before the run
@@ -49,12 +42,13 @@ namespace Rivet {
 
       const FinalState fs(Cuts::absrap<0.35&&Cuts::abscharge>0);
       declare(fs,"fs");
+      declare(AncestorFlags(), "Ancestry");
 
       beamOpt = getOption<string>("beam","NONE");
       if (beamOpt == "dAU200") collSys = dAu200;
       else if (beamOpt == "AUAU200") collSys = AuAu200;
 
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
       //****Counters****
       book(sow["sow_dAU20"],"sow_dAU20");
@@ -320,10 +314,11 @@ namespace Rivet {
 
       //rpc_AuAu/dAu proton
 
-
-
-
-
+      // Invariant-yield fillers, weighted with the pT bin centres
+      ydAu_Yields = invariantYields(hdAu_Yields);
+      yAuAu_Yields = invariantYields(hAuAu_Yields);
+      yTemp_ratio_dAu = invariantYields(hTemp_ratio_dAu);
+      yTemp_ratio_AuAu = invariantYields(hTemp_ratio_AuAu);
     }
 
 
@@ -331,6 +326,7 @@ namespace Rivet {
     void analyze(const Event& event) {
 
       Particles chargedP = applyProjection<FinalState>(event,"fs").particles();
+      const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
 
       if (collSys == AuAu200) {
 
@@ -343,130 +339,42 @@ namespace Rivet {
           sow["sow_AUAU10"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC10"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC10_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC10_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiplusC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiplusC10"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiplusC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiplusC10"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC10"].fill(partPt);
+              yTemp_ratio_AuAu["PiC10_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiplusC10"].fill(partPt);
+              yAuAu_Yields["PiplusC10"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC10"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC10_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC10_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiminusC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiminusC10"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiminusC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiminusC10"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC10"].fill(partPt);
+              yTemp_ratio_AuAu["PiC10_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiminusC10"].fill(partPt);
+              yAuAu_Yields["PiminusC10"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC10"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KplusC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KplusC10"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KplusC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KplusC10"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC10"].fill(partPt);
+              yTemp_ratio_AuAu["KplusC10"].fill(partPt);
+              yAuAu_Yields["KplusC10"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC10"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KminusC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KminusC10"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KminusC10"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KminusC10"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC10"].fill(partPt);
+              yTemp_ratio_AuAu["KminusC10"].fill(partPt);
+              yAuAu_Yields["KminusC10"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC10_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC10_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC10"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC10"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["PC10"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["PC10"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC10_2"].fill(partPt);
+                      yTemp_ratio_AuAu["PC10"].fill(partPt);
+                      yAuAu_Yields["PC10"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC10_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC10_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["P_barC10"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["P_barC10"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["P_barC10"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["P_barC10"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC10_2"].fill(partPt);
+                      yTemp_ratio_AuAu["P_barC10"].fill(partPt);
+                      yAuAu_Yields["P_barC10"].fill(partPt);
                     }
             }
           }
@@ -477,130 +385,42 @@ namespace Rivet {
           sow["sow_AUAU20"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC20_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC20_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiplusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiplusC20"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC20"].fill(partPt);
+              yTemp_ratio_AuAu["PiC20_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiplusC20"].fill(partPt);
+              yAuAu_Yields["PiplusC20"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC20_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC20_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiminusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiminusC20"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC20"].fill(partPt);
+              yTemp_ratio_AuAu["PiC20_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiminusC20"].fill(partPt);
+              yAuAu_Yields["PiminusC20"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KplusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KplusC20"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC20"].fill(partPt);
+              yTemp_ratio_AuAu["KplusC20"].fill(partPt);
+              yAuAu_Yields["KplusC20"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KminusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KminusC20"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC20"].fill(partPt);
+              yTemp_ratio_AuAu["KminusC20"].fill(partPt);
+              yAuAu_Yields["KminusC20"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC20_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC20_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC20"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["PC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["PC20"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC20_2"].fill(partPt);
+                      yTemp_ratio_AuAu["PC20"].fill(partPt);
+                      yAuAu_Yields["PC20"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC20_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC20_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["P_barC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["P_barC20"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["P_barC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["P_barC20"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC20_2"].fill(partPt);
+                      yTemp_ratio_AuAu["P_barC20"].fill(partPt);
+                      yAuAu_Yields["P_barC20"].fill(partPt);
                     }
             }
           }
@@ -612,130 +432,42 @@ namespace Rivet {
           sow["sow_AUAU40"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC40_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC40_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiplusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiplusC40"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC40"].fill(partPt);
+              yTemp_ratio_AuAu["PiC40_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiplusC40"].fill(partPt);
+              yAuAu_Yields["PiplusC40"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC40_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC40_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiminusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiminusC40"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC40"].fill(partPt);
+              yTemp_ratio_AuAu["PiC40_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiminusC40"].fill(partPt);
+              yAuAu_Yields["PiminusC40"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KplusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KplusC40"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC40"].fill(partPt);
+              yTemp_ratio_AuAu["KplusC40"].fill(partPt);
+              yAuAu_Yields["KplusC40"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KminusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KminusC40"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC40"].fill(partPt);
+              yTemp_ratio_AuAu["KminusC40"].fill(partPt);
+              yAuAu_Yields["KminusC40"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC40_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC40_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC40"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["PC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["PC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC40_2"].fill(partPt);
+                      yTemp_ratio_AuAu["PC40"].fill(partPt);
+                      yAuAu_Yields["PC40"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC40_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC40_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["P_barC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["P_barC40"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["P_barC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["P_barC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC40_2"].fill(partPt);
+                      yTemp_ratio_AuAu["P_barC40"].fill(partPt);
+                      yAuAu_Yields["P_barC40"].fill(partPt);
                     }
             }
           }
@@ -746,130 +478,42 @@ namespace Rivet {
           sow["sow_AUAU60"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC60_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC60_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiplusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiplusC60"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC60"].fill(partPt);
+              yTemp_ratio_AuAu["PiC60_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiplusC60"].fill(partPt);
+              yAuAu_Yields["PiplusC60"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC60_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC60_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiminusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiminusC60"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC60"].fill(partPt);
+              yTemp_ratio_AuAu["PiC60_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiminusC60"].fill(partPt);
+              yAuAu_Yields["PiminusC60"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KplusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KplusC60"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC60"].fill(partPt);
+              yTemp_ratio_AuAu["KplusC60"].fill(partPt);
+              yAuAu_Yields["KplusC60"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KminusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KminusC60"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC60"].fill(partPt);
+              yTemp_ratio_AuAu["KminusC60"].fill(partPt);
+              yAuAu_Yields["KminusC60"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC60_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC60_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC60"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["PC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["PC60"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC60_2"].fill(partPt);
+                      yTemp_ratio_AuAu["PC60"].fill(partPt);
+                      yAuAu_Yields["PC60"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC60_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC60_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["P_barC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["P_barC60"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["P_barC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["P_barC60"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC60_2"].fill(partPt);
+                      yTemp_ratio_AuAu["P_barC60"].fill(partPt);
+                      yAuAu_Yields["P_barC60"].fill(partPt);
                     }
             }
           }
@@ -880,130 +524,42 @@ namespace Rivet {
           sow["sow_AUAU92"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC92"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC92_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC92_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiplusC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiplusC92"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiplusC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiplusC92"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC92"].fill(partPt);
+              yTemp_ratio_AuAu["PiC92_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiplusC92"].fill(partPt);
+              yAuAu_Yields["PiplusC92"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC92"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiC92_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiC92_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["PiminusC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["PiminusC92"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["PiminusC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["PiminusC92"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["PiC92"].fill(partPt);
+              yTemp_ratio_AuAu["PiC92_2"].fill(partPt);
+              yTemp_ratio_AuAu["PiminusC92"].fill(partPt);
+              yAuAu_Yields["PiminusC92"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC92"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KplusC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KplusC92"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KplusC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KplusC92"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC92"].fill(partPt);
+              yTemp_ratio_AuAu["KplusC92"].fill(partPt);
+              yAuAu_Yields["KplusC92"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_AuAu["KC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KC92"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_AuAu["KminusC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_AuAu["KminusC92"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hAuAu_Yields["KminusC92"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hAuAu_Yields["KminusC92"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_AuAu["KC92"].fill(partPt);
+              yTemp_ratio_AuAu["KminusC92"].fill(partPt);
+              yAuAu_Yields["KminusC92"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC92_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC92_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC92"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC92"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["PC92"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["PC92"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC92_2"].fill(partPt);
+                      yTemp_ratio_AuAu["PC92"].fill(partPt);
+                      yAuAu_Yields["PC92"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_AuAu["PC92_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["PC92_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_AuAu["P_barC92"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_AuAu["P_barC92"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hAuAu_Yields["P_barC92"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hAuAu_Yields["P_barC92"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_AuAu["PC92_2"].fill(partPt);
+                      yTemp_ratio_AuAu["P_barC92"].fill(partPt);
+                      yAuAu_Yields["P_barC92"].fill(partPt);
                     }
             }
           }
@@ -1024,230 +580,62 @@ namespace Rivet {
           sow["sow_dAU100"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC20_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC20_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC20"].fill(partPt);
+              yTemp_ratio_dAu["PiC20_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC20"].fill(partPt);
+              ydAu_Yields["PiplusC20"].fill(partPt);
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC100"].fill(partPt);
+              ydAu_Yields["PiplusC100"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC20_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC20_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC20"].fill(partPt);
+              yTemp_ratio_dAu["PiC20_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC20"].fill(partPt);
+              ydAu_Yields["PiminusC20"].fill(partPt);
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC100"].fill(partPt);
+              ydAu_Yields["PiminusC100"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC20"].fill(partPt);
+              yTemp_ratio_dAu["KplusC20"].fill(partPt);
+              ydAu_Yields["KplusC20"].fill(partPt);
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KplusC100"].fill(partPt);
+              ydAu_Yields["KplusC100"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC20"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC20"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC20"].fill(partPt);
+              yTemp_ratio_dAu["KminusC20"].fill(partPt);
+              ydAu_Yields["KminusC20"].fill(partPt);
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KminusC100"].fill(partPt);
+              ydAu_Yields["KminusC100"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC20_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC20_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC20"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC20"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC100"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC20_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC20"].fill(partPt);
+                      ydAu_Yields["PC20"].fill(partPt);
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC100"].fill(partPt);
+                      ydAu_Yields["PC100"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC20_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC20_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC20"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC20"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC20"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC20_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC20"].fill(partPt);
+                      ydAu_Yields["P_barC20"].fill(partPt);
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC100"].fill(partPt);
+                      ydAu_Yields["P_barC100"].fill(partPt);
                     }
             }
           }
@@ -1259,230 +647,62 @@ namespace Rivet {
           sow["sow_dAU100"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC40_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC40_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC40"].fill(partPt);
+              yTemp_ratio_dAu["PiC40_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC40"].fill(partPt);
+              ydAu_Yields["PiplusC40"].fill(partPt);
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC100"].fill(partPt);
+              ydAu_Yields["PiplusC100"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC40_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC40_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC40"].fill(partPt);
+              yTemp_ratio_dAu["PiC40_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC40"].fill(partPt);
+              ydAu_Yields["PiminusC40"].fill(partPt);
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC100"].fill(partPt);
+              ydAu_Yields["PiminusC100"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC40"].fill(partPt);
+              yTemp_ratio_dAu["KplusC40"].fill(partPt);
+              ydAu_Yields["KplusC40"].fill(partPt);
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KplusC100"].fill(partPt);
+              ydAu_Yields["KplusC100"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC40"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC40"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC40"].fill(partPt);
+              yTemp_ratio_dAu["KminusC40"].fill(partPt);
+              ydAu_Yields["KminusC40"].fill(partPt);
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KminusC100"].fill(partPt);
+              ydAu_Yields["KminusC100"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC40_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC40_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC40"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC40"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC100"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC40_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC40"].fill(partPt);
+                      ydAu_Yields["PC40"].fill(partPt);
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC100"].fill(partPt);
+                      ydAu_Yields["PC100"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC40_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC40_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC40"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC40"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC40"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC40_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC40"].fill(partPt);
+                      ydAu_Yields["P_barC40"].fill(partPt);
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC100"].fill(partPt);
+                      ydAu_Yields["P_barC100"].fill(partPt);
                     }
             }
           }
@@ -1493,230 +713,62 @@ namespace Rivet {
           sow["sow_dAU100"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC60_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC60_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC60"].fill(partPt);
+              yTemp_ratio_dAu["PiC60_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC60"].fill(partPt);
+              ydAu_Yields["PiplusC60"].fill(partPt);
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC100"].fill(partPt);
+              ydAu_Yields["PiplusC100"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC60_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC60_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC60"].fill(partPt);
+              yTemp_ratio_dAu["PiC60_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC60"].fill(partPt);
+              ydAu_Yields["PiminusC60"].fill(partPt);
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC100"].fill(partPt);
+              ydAu_Yields["PiminusC100"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC60"].fill(partPt);
+              yTemp_ratio_dAu["KplusC60"].fill(partPt);
+              ydAu_Yields["KplusC60"].fill(partPt);
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KplusC100"].fill(partPt);
+              ydAu_Yields["KplusC100"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC60"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC60"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC60"].fill(partPt);
+              yTemp_ratio_dAu["KminusC60"].fill(partPt);
+              ydAu_Yields["KminusC60"].fill(partPt);
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KminusC100"].fill(partPt);
+              ydAu_Yields["KminusC100"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC60_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC60_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC60"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC60"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC100"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC60_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC60"].fill(partPt);
+                      ydAu_Yields["PC60"].fill(partPt);
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC100"].fill(partPt);
+                      ydAu_Yields["PC100"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC60_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC60_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC60"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC60"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC60"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC60_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC60"].fill(partPt);
+                      ydAu_Yields["P_barC60"].fill(partPt);
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC100"].fill(partPt);
+                      ydAu_Yields["P_barC100"].fill(partPt);
                     }
             }
           }
@@ -1728,230 +780,62 @@ namespace Rivet {
           sow["sow_dAU100"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC88_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC88_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC88"].fill(partPt);
+              yTemp_ratio_dAu["PiC88_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC88"].fill(partPt);
+              ydAu_Yields["PiplusC88"].fill(partPt);
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC100"].fill(partPt);
+              ydAu_Yields["PiplusC100"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC88_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC88_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC88"].fill(partPt);
+              yTemp_ratio_dAu["PiC88_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC88"].fill(partPt);
+              ydAu_Yields["PiminusC88"].fill(partPt);
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC100"].fill(partPt);
+              ydAu_Yields["PiminusC100"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC88"].fill(partPt);
+              yTemp_ratio_dAu["KplusC88"].fill(partPt);
+              ydAu_Yields["KplusC88"].fill(partPt);
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KplusC100"].fill(partPt);
+              ydAu_Yields["KplusC100"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC88"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC88"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC88"].fill(partPt);
+              yTemp_ratio_dAu["KminusC88"].fill(partPt);
+              ydAu_Yields["KminusC88"].fill(partPt);
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KminusC100"].fill(partPt);
+              ydAu_Yields["KminusC100"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC88_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC88_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC88"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC88"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC88"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC88"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC100"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC88_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC88"].fill(partPt);
+                      ydAu_Yields["PC88"].fill(partPt);
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC100"].fill(partPt);
+                      ydAu_Yields["PC100"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC88_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC88_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC88"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC88"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC88"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC88"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC88_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC88"].fill(partPt);
+                      ydAu_Yields["P_barC88"].fill(partPt);
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC100"].fill(partPt);
+                      ydAu_Yields["P_barC100"].fill(partPt);
                     }
             }
           }
@@ -1962,130 +846,42 @@ namespace Rivet {
           sow["sow_dAU100"]->fill();
           for (const Particle& p :chargedP) {
             double partPt = p.pT() / GeV;
-            double pt_weight = 1. / (2.*M_PI);
-            double deltaPt = 0.;
 
             if (p.pid() == 211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiplusC100"].fill(partPt);
+              ydAu_Yields["PiplusC100"].fill(partPt);
             }
             if (p.pid() == -211) {
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiC100_2"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiC100_2"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["PiminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["PiminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["PiminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["PiC100"].fill(partPt);
+              yTemp_ratio_dAu["PiC100_2"].fill(partPt);
+              yTemp_ratio_dAu["PiminusC100"].fill(partPt);
+              ydAu_Yields["PiminusC100"].fill(partPt);
             }
             if (p.pid() == 321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KplusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KplusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KplusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KplusC100"].fill(partPt);
+              ydAu_Yields["KplusC100"].fill(partPt);
             }
 
             if (p.pid() == -321) {
-              if (getDeltaPt(*hTemp_ratio_dAu["KC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hTemp_ratio_dAu["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hTemp_ratio_dAu["KminusC100"]->fill(partPt, pt_weight);
-              }
-              if (getDeltaPt(*hdAu_Yields["KminusC100"], partPt, deltaPt))
-              {
-                pt_weight /= deltaPt;
-                hdAu_Yields["KminusC100"]->fill(partPt, pt_weight);
-              }
+              yTemp_ratio_dAu["KC100"].fill(partPt);
+              yTemp_ratio_dAu["KminusC100"].fill(partPt);
+              ydAu_Yields["KminusC100"].fill(partPt);
             }
             if (p.pid() == 2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["PC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["PC100"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["PC100"].fill(partPt);
+                      ydAu_Yields["PC100"].fill(partPt);
                     }
             }
             if (p.pid() == -2212) {
-              if (!(p.hasAncestor(3122) || p.hasAncestor(3122) ||   //Lambda+/-
-                    p.hasAncestor(3212) || p.hasAncestor(3222) ||   //Sigma0, Sigma+
-                    p.hasAncestor(3322) || p.hasAncestor(3312) ||   //Xi0, Xi-
-                    p.hasAncestor(3334) )) {                        //Omega-
-                      if (getDeltaPt(*hTemp_ratio_dAu["PC100_2"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["PC100_2"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hTemp_ratio_dAu["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hTemp_ratio_dAu["P_barC100"]->fill(partPt, pt_weight);
-                      }
-                      if (getDeltaPt(*hdAu_Yields["P_barC100"], partPt, deltaPt))
-                      {
-                        pt_weight /= deltaPt;
-                        hdAu_Yields["P_barC40"]->fill(partPt, pt_weight);
-                      }
+              if (!ancestry.hasAncestor(p, AncestorFlags::HYPERON)) {
+                      yTemp_ratio_dAu["PC100_2"].fill(partPt);
+                      yTemp_ratio_dAu["P_barC100"].fill(partPt);
+                      ydAu_Yields["P_barC100"].fill(partPt);
                     }
             }
           }
@@ -2387,7 +1183,9 @@ namespace Rivet {
 
 
     map<string, Histo1DPtr> hdAu_Yields;
+    map<string, InvariantYield> ydAu_Yields;
     map<string, Histo1DPtr> hAuAu_Yields;
+    map<string, InvariantYield> yAuAu_Yields;
 
     map<string, Histo1DPtr> hRcp;
     map<string, Histo1DPtr> hRAA;
@@ -2396,7 +1194,9 @@ namespace Rivet {
 
 
     map<string, Histo1DPtr> hTemp_ratio_dAu;
+    map<string, InvariantYield> yTemp_ratio_dAu;
     map<string, Histo1DPtr> hTemp_ratio_AuAu;
+    map<string, InvariantYield> yTemp_ratio_AuAu;
     map<string, Scatter2DPtr> RatiodAu;
     map<string, Scatter2DPtr> RatioAuAu;
 
@@ -6,6 +6,7 @@
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 namespace Rivet {
 
@@ -26,7 +27,7 @@ namespace Rivet {
      
       beamOpt = getOption<string>("beam", "NONE");
  
-      declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
       
       const FinalState fs(Cuts::abseta < 0.35 && Cuts::pT > 0.0*GeV && Cuts::pT < 20.0*GeV);
       declare(fs, "fs");
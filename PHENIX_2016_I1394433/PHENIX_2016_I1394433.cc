@@ -6,6 +6,7 @@
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/PromptFinalState.hh"
 //#include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 #include "Centralities/RHICCentrality.hh"
 
 #include "Rivet/Projections/ChargedFinalState.hh"
@@ -31,7 +32,7 @@ namespace Rivet {
 
     void init() {
 
-    declareCentrality(RHICCentrality("PHENIX"),"RHIC_2019_CentralityCalibration:exp=PHENIX","CMULT","CMULT");
+    DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
         
      if(fuzzyEquals(sqrtS()/GeV, 200*197, 1E-3))
      {
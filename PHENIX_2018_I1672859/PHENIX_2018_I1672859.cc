@@ -3,6 +3,7 @@
 #include "Rivet/Projections/FinalState.hh"
 #include "Rivet/Projections/UnstableParticles.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 #include <math.h>
 #define _USE_MATH_DEFINES
 const double TAB[9] = {2.54, 8.8, 6.0, 7.5, 3.1, 1.0, 0.179, 8.9, 2.86};
@@ -26,7 +27,7 @@ public:
 		//~ eta pdg id: 221
 		//~ pi0 pdg id: 111
 		beamOpt = getOption<string>("beam", "NONE");      
-		declareCentrality(RHICCentrality("PHENIX"),"RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+		DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
 
 		// Initialise and register projections
 		// The basic final-state projection: all final-state particles within the given eta acceptance
@@ -4,6 +4,7 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "Rivet/Projections/ChargedFinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 #include <math.h>
 #define _USE_MATH_DEFINES
 namespace Rivet {
@@ -21,7 +22,7 @@ public:
 
 		beamOpt = getOption<string>("beam", "NONE");
 
-		declareCentrality(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT", "CMULT");
+		DECLARE_RHIC_CENTRALITY(RHICCentrality("PHENIX"), "RHIC_2019_CentralityCalibration:exp=PHENIX", "CMULT");
       
 		const PromptFinalState pfs(Cuts::abseta < 0.35 && Cuts::pid == 22);
 		declare(pfs, "pfs");
@@ -2,6 +2,7 @@
 #include "Rivet/Analysis.hh"
 #include "Rivet/Projections/PrimaryParticles.hh"
 #include "../Centralities/RHICCentrality.hh" //external header for Centrality calculation
+#include "../Centralities/CentralityTable.hh"
 #define _USE_MATH_DEFINES
 namespace Rivet {
   /// @brief Add a short analysis description here
@@ -65,7 +66,7 @@ namespace Rivet {
       const Scatter2D& refdatappRatio6080 =refData(refnameppRatio6080);
 
       //Centrality
-      declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
 
       //pp at 200 GeV
       book(chSpectrum["chSpectrum0_5_pp"], refnameppRatio05 + "_pp", refdatappRatio05);
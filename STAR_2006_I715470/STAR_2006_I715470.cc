@@ -12,6 +12,7 @@
 #include <math.h>
 #include <vector>
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 #define _USE_MATH_DEFINES
 static const int numTrigPtBins = 3;
@@ -188,20 +189,6 @@ namespace Rivet {
         return true;
       }
    
-      bool isSecondary(Particle p)
-      {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-          p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-          p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-          p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-          p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-          p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-          p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-          return true;
-        else return false;
-       
-      }
     double CalculateVn(YODA::Histo1D& hist, int nth)
     {
         int nBins = hist.numBins();
@@ -372,7 +359,7 @@ namespace Rivet {
       if (beamOpt == "AUAU200") collSys = AuAu200;
       else if (beamOpt == "dAU200") collSys = dAu200;
       
-      declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
 
 int ndPhiBins = 72*4;
 double lowedge = -pi/2.0;
@@ -513,8 +500,6 @@ cout<<"This loop repeats some names for histograms which are made above.  I did
     // loop over charged final state particles - PI
      for(const Particle& pTrig : cfs.particles()){
 
-        //Check if is secondary
-        //if(isSecondary(pTrig)) continue;
           
         
         for(Correlator& corr : Correlators)
@@ -532,8 +517,6 @@ cout<<"This loop repeats some names for histograms which are made above.  I did
             //Check if Trigger and Associated are the same particle
             if(isSameParticle(pTrig,pAssoc)) continue;
                 
-            //Check if is secondary
-            //if(isSecondary(pAssoc)) continue;
 
             //https://rivet.hepforge.org/code/dev/structRivet_1_1DeltaPhiInRange.html
             //double dPhi = deltaPhi(pTrig, pAssoc, true);//this does NOT rotate the delta phi to be in a given range
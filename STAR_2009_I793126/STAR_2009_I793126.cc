@@ -6,9 +6,17 @@
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/InvariantYield.hh"
+#include "../Spectra/Binning.hh"
 
 namespace Rivet {
 
+  // Centrality classes of the dAu 200 GeV, AuAu 62.4 GeV and AuAu 130 GeV spectra
+  static constexpr auto CentdAu200 = makeBinning(0., 20., 40., 100.);
+  static constexpr auto CentAuAu62 = makeBinning(0., 5., 10., 20., 30., 40., 50., 60., 70., 80.);
+  static constexpr auto CentAuAu130 = makeBinning(0., 6., 11., 18., 26., 34., 45., 58., 85.);
+
 
   /// @brief Add a short analysis description here
   class STAR_2009_I793126 : public Analysis {
@@ -17,18 +25,6 @@ namespace Rivet {
     /// Constructor
     DEFAULT_RIVET_ANALYSIS_CTOR(STAR_2009_I793126);
 
-    bool getDeltaPt(YODA::Histo1D hist, double pT, double &deltaPt) //Antonio function for dividing by pT bin center
-       {
-           //cout << "pT: " << pT << endl;
-           if(pT > hist.xMin() && pT < hist.xMax())
-           {
-               deltaPt = hist.bin(hist.binIndexAt(pT)).xMid();
-               //cout << "DeltapT: " << deltaPt << endl;
-               return true;
-           }
-           else return false;
-       }
-
 
     /// @name Analysis methods
     //@{
@@ -36,7 +32,7 @@ namespace Rivet {
     /// Book histograms and initialise projections before the run
     void init() {
 
-      declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
 
       // Initialise and register projections
 
@@ -80,6 +76,11 @@ namespace Rivet {
       book(_c["sow_AuAu130c4558"], "sow_AuAu130c4558");
       book(_c["sow_AuAu130c5885"], "sow_AuAu130c5885");
 
+      //Event counters of the centrality classes, in the order of the binnings
+      for(const char* cl : {"0020", "2040", "40100"}) _sowdAu200.push_back(_c[string("sow_dAu200c") + cl]);
+      for(const char* cl : {"0005", "0510", "1020", "2030", "3040", "4050", "5060", "6070", "7080"}) _sowAuAu62.push_back(_c[string("sow_AuAu62c") + cl]);
+      for(const char* cl : {"0006", "0611", "1118", "1826", "2634", "3445", "4558", "5885"}) _sowAuAu130.push_back(_c[string("sow_AuAu130c") + cl]);
+
       //Booking histograms for figures in paper
       /*//Figure 1 AuAu200
       book(_h["Figure_1_AuAu200"], 1, 1, 1);
@@ -427,6 +428,9 @@ namespace Rivet {
       //Figure 42 MC Glauber
       book(_h["Figure_42_MC_Glauber"], 110, 1, 1);*/
 
+      // Invariant-yield fillers, weighted with the pT bin centres
+      _y = invariantYields(_h);
+
     }
 
 
@@ -445,48 +449,11 @@ namespace Rivet {
 
         if (beam.first.pid() == 1000791970 && beam.second.pid() == 1000791970)
         {
-            if(fuzzyEquals(sqrtS()/GeV, 62.4*NNAuAu, 1E-3))
-            {
-              collSys = AuAu62;
-              if(c < 5.) _c["sow_AuAu62c0005"]->fill();
-              else if(c >=5. && c < 10.) _c["sow_AuAu62c0510"]->fill();
-              else if(c >=10. && c < 20.) _c["sow_AuAu62c1020"]->fill();
-              else if(c >=20. && c < 30.) _c["sow_AuAu62c2030"]->fill();
-              else if(c >=30. && c < 40.) _c["sow_AuAu62c3040"]->fill();
-              else if(c >=40. && c < 50.) _c["sow_AuAu62c4050"]->fill();
-              else if(c >=50. && c < 60.) _c["sow_AuAu62c5060"]->fill();
-              else if(c >=60. && c < 70.) _c["sow_AuAu62c6070"]->fill();
-              else if(c >=70. && c < 80.) _c["sow_AuAu62c7080"]->fill();
-            }
-            else if(fuzzyEquals(sqrtS()/GeV, 130.*NNAuAu, 1E-3))
-            {
-              collSys = AuAu130;
-              if(c < 6.) _c["sow_AuAu130c0006"]->fill();
-              else if(c >= 6. && c < 11.) _c["sow_AuAu130c0611"]->fill();
-              else if(c >= 11. && c < 18.) _c["sow_AuAu130c1118"]->fill();
-              else if(c >= 18. && c < 26.) _c["sow_AuAu130c1826"]->fill();
-              else if(c >= 26. && c < 34.) _c["sow_AuAu130c2634"]->fill();
-              else if(c >= 34. && c < 45.) _c["sow_AuAu130c3445"]->fill();
-              else if(c >= 45. && c < 58.) _c["sow_AuAu130c4558"]->fill();
-              else if(c >= 58. && c < 85.) _c["sow_AuAu130c5885"]->fill();
-            }
-        }
-        else if(beam.first.pid() == 1000010020 && beam.second.pid() == 1000791970)
-        {
-          collSys = dAu200;
-          _c["sow_dAu200"]->fill();
-          if(c < 20.) _c["sow_dAu200c0020"]->fill();
-          else if(c >= 20. && c < 40.) _c["sow_dAu200c2040"]->fill();
-          else _c["sow_dAu200c40100"]->fill();
-        }
-        else if(beam.first.pid() == 1000791970 && beam.second.pid() == 1000010020)
-        {
-          collSys = dAu200;
-          _c["sow_dAu200"]->fill();
-          if(c < 20.) _c["sow_dAu200c0020"]->fill();
-          else if(c >= 20. && c < 40.) _c["sow_dAu200c2040"]->fill();
-          else _c["sow_dAu200c40100"]->fill();
+            if(fuzzyEquals(sqrtS()/GeV, 62.4*NNAuAu, 1E-3)) collSys = AuAu62;
+            else if(fuzzyEquals(sqrtS()/GeV, 130.*NNAuAu, 1E-3)) collSys = AuAu130;
         }
+        else if(beam.first.pid() == 1000010020 && beam.second.pid() == 1000791970) collSys = dAu200;
+        else if(beam.first.pid() == 1000791970 && beam.second.pid() == 1000010020) collSys = dAu200;
       }
 
       //Sorting events by energy
@@ -494,67 +461,63 @@ namespace Rivet {
       //Sorting particles by type
       if (collSys == dAu200)
       {
+        _c["sow_dAu200"]->fill();
+        const int ic = CentdAu200.index(c);
+        if(ic >= 0) _sowdAu200[ic]->fill();
+
+        //Histograms of the centrality class of the event, 0-20% is the highest number in the figure
+        InvariantYield* kplus = ic >= 0 ? &_y["Figure_18_kaon_" + std::to_string(4 - ic)] : nullptr;
+        InvariantYield* kminus = ic >= 0 ? &_y["Figure_18_kaon_" + std::to_string(8 - ic)] : nullptr;
+        InvariantYield* piplus = ic >= 0 ? &_y["Figure_18_pion_" + std::to_string(4 - ic)] : nullptr;
+        InvariantYield* piminus = ic >= 0 ? &_y["Figure_18_pion_" + std::to_string(8 - ic)] : nullptr;
+        InvariantYield* pplus = ic >= 0 ? &_y["Figure_18_proton_" + std::to_string(4 - ic)] : nullptr;
+        InvariantYield* pminus = ic >= 0 ? &_y["Figure_18_proton_" + std::to_string(8 - ic)] : nullptr;
+        const InvariantYield& kplusMB = _y["Figure_18_kaon_1"];
+        const InvariantYield& kminusMB = _y["Figure_18_kaon_5"];
+        const InvariantYield& piplusMB = _y["Figure_18_pion_1"];
+        const InvariantYield& piminusMB = _y["Figure_18_pion_5"];
+        const InvariantYield& pplusMB = _y["Figure_18_proton_1"];
+        const InvariantYield& pminusMB = _y["Figure_18_proton_5"];
+
         for (const Particle& p : fsParticles) {
 
-          //for filling pT bin center
           double partPt = p.pT()/GeV;
-          double OneOver2pi = 1./(2.*M_PI);
-          double deltaPt = 0.;
-
-          if(getDeltaPt(*_h["Figure_18_kaon_1"], partPt, deltaPt)){  //line from Antonio for filling with pT bin center
 
+          if(kplusMB.index(partPt) >= 0){  //all histograms of the figure share the pT binning
 
             if (p.pid() == -321) { //kaon+ (KPLUS Pdgid = 321)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 20.0) _h["Figure_18_kaon_4"]->fill(p.pT()/GeV, pt_weight); // 0-20% centrality
-              if (c > 20.0 && c < 40.0) _h["Figure_18_kaon_3"]->fill(p.pT()/GeV, pt_weight); // 20-40% centrality
-              _h["Figure_18_kaon_1"]->fill(p.pT()/GeV, pt_weight); // Min Bias
-              if (c > 40.0) _h["Figure_18_kaon_2"]->fill(p.pT()/GeV, pt_weight); // 40-100% centrality
+              if (kplus) kplus->fill(partPt);
+              kplusMB.fill(partPt); // Min Bias
             }
             if (p.pid() == 321) { //kaon- (KMINUS Pdgid = -321)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 20.0) _h["Figure_18_kaon_8"]->fill(p.pT()/GeV, pt_weight);
-              if (c > 20.0 && c < 40.0) _h["Figure_18_kaon_7"]->fill(p.pT()/GeV, pt_weight); // 20-40% centrality
-              _h["Figure_18_kaon_5"]->fill(p.pT()/GeV, pt_weight); // Min Bias
-              if (c > 40.0) _h["Figure_18_kaon_6"]->fill(p.pT()/GeV, pt_weight); // 40-100% centrality
+              if (kminus) kminus->fill(partPt);
+              kminusMB.fill(partPt); // Min Bias
             }
 
            }
 
-          if(getDeltaPt(*_h["Figure_18_pion_1"], partPt, deltaPt)){  //line from Antonio for filling with pT bin center
+          if(piplusMB.index(partPt) >= 0){  //all histograms of the figure share the pT binning
 
             if (p.pid() == -211 && p.parents()[0].abspid() != 3122 && p.parents()[0].abspid() != 310 && p.parents()[0].abspid() != 13) { //pion+ (PIPLUS Pdgid = 211)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 20.0) _h["Figure_18_pion_4"]->fill(p.pT()/GeV, pt_weight); // 0-20% centrality
-              if (c > 20.0 && c < 40.0) _h["Figure_18_pion_3"]->fill(p.pT()/GeV, pt_weight); // 20-40% centrality
-              _h["Figure_18_pion_1"]->fill(p.pT()/GeV, pt_weight); // Min Bias
-              if (c > 40.0) _h["Figure_18_pion_2"]->fill(p.pT()/GeV, pt_weight); // 40-100% centrality
+              if (piplus) piplus->fill(partPt);
+              piplusMB.fill(partPt); // Min Bias
             }
             if (p.pid() == 211 && p.parents()[0].abspid() != 3122 && p.parents()[0].abspid() != 310 && p.parents()[0].abspid() != 13) { //pion- (PIMINUS Pdgis = -211)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 20.0) _h["Figure_18_pion_8"]->fill(p.pT()/GeV, pt_weight);
-              if (c > 20.0 && c < 40.0) _h["Figure_18_pion_7"]->fill(p.pT()/GeV, pt_weight); // 20-40% centrality
-              _h["Figure_18_pion_5"]->fill(p.pT()/GeV, pt_weight); // Min Bias
-              if (c > 40.0) _h["Figure_18_pion_6"]->fill(p.pT()/GeV, pt_weight); // 40-100% centrality
+              if (piminus) piminus->fill(partPt);
+              piminusMB.fill(partPt); // Min Bias
             }
 
            }
 
-          if(getDeltaPt(*_h["Figure_18_proton_1"], partPt, deltaPt)){  //line from Antonio for filling with pT bin center
+          if(pplusMB.index(partPt) >= 0){  //all histograms of the figure share the pT binning
 
             if (p.pid() == -2212) { //proton+ (PROTON Pdgid = 2212)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 20.0) _h["Figure_18_proton_4"]->fill(p.pT()/GeV, pt_weight); // 0-20% centrality
-              if (c > 20.0 && c < 40.0) _h["Figure_18_proton_3"]->fill(p.pT()/GeV, pt_weight); // 20-40% centrality
-              _h["Figure_18_proton_1"]->fill(p.pT()/GeV, pt_weight); // Min Bias
-              if (c > 40.0) _h["Figure_18_proton_2"]->fill(p.pT()/GeV, pt_weight); // 40-100% centrality
+              if (pplus) pplus->fill(partPt);
+              pplusMB.fill(partPt); // Min Bias
             }
             if (p.pid() == 2212) { //proton- (ANTIPROTON Pdgid = -2212)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 20.0) _h["Figure_18_proton_8"]->fill(p.pT()/GeV, pt_weight);
-              if (c > 20.0 && c < 40.0) _h["Figure_18_proton_7"]->fill(p.pT()/GeV, pt_weight); // 20-40% centrality
-              _h["Figure_18_proton_5"]->fill(p.pT()/GeV, pt_weight); // Min Bias
-              if (c > 40.0) _h["Figure_18_proton_6"]->fill(p.pT()/GeV, pt_weight); // 40-100% centrality
+              if (pminus) pminus->fill(partPt);
+              pminusMB.fill(partPt); // Min Bias
             }
           }
 
@@ -564,98 +527,44 @@ namespace Rivet {
       //Figure 19 AuAu @ 62.4 GeV
       if (collSys == AuAu62)
       {
+        const int ic = CentAuAu62.index(c);
+        if(ic < 0) return;
+        _sowAuAu62[ic]->fill();
+
+        //Histograms of the centrality class of the event, 0-5% is the highest number in the figure
+        const InvariantYield& kplus = _y["Figure_19_kaon_" + std::to_string(9 - ic)];
+        const InvariantYield& kminus = _y["Figure_19_kaon_" + std::to_string(18 - ic)];
+        const InvariantYield& piplus = _y["Figure_19_pion_" + std::to_string(9 - ic)];
+        const InvariantYield& piminus = _y["Figure_19_pion_" + std::to_string(18 - ic)];
+        const InvariantYield& pplus = _y["Figure_19_proton_" + std::to_string(9 - ic)];
+        const InvariantYield& pminus = _y["Figure_19_proton_" + std::to_string(18 - ic)];
+
         for (const Particle& p : fsParticles) {
 
-          //for filling pT bin center
           double partPt = p.pT()/GeV;
-          double OneOver2pi = 1./(2.*M_PI);
-          double deltaPt = 0.;
-
-          if(getDeltaPt(*_h["Figure_19_kaon_1"], partPt, deltaPt)){  //line from Antonio for filling with pT bin center (all have same bin width)
 
-            if (p.pid() == -321) { //kaon+ (KPLUS Pdgid = 321)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 5.0) _h["Figure_19_kaon_9"]->fill(p.pT()/GeV, pt_weight); // 0-5% centrality
-              if (c > 5.0 && c < 10.0) _h["Figure_19_kaon_8"]->fill(p.pT()/GeV, pt_weight); // 5-10% centrality
-              if (c > 10.0 && c < 20.0) _h["Figure_19_kaon_7"]->fill(p.pT()/GeV, pt_weight); // 10-20% centrality
-              if (c > 20.0 && c < 30.0) _h["Figure_19_kaon_6"]->fill(p.pT()/GeV, pt_weight); // 20-30% centrality
-              if (c > 30.0 && c < 40.0) _h["Figure_19_kaon_5"]->fill(p.pT()/GeV, pt_weight); // 30-40% centrality
-              if (c > 40.0 && c < 50.0) _h["Figure_19_kaon_4"]->fill(p.pT()/GeV, pt_weight); // 40-50% centrality
-              if (c > 50.0 && c < 60.0) _h["Figure_19_kaon_3"]->fill(p.pT()/GeV, pt_weight); // 50-60% centrality
-              if (c > 60.0 && c < 70.0) _h["Figure_19_kaon_2"]->fill(p.pT()/GeV, pt_weight); // 60-70% centrality
-              if (c > 70.0 && c < 80.0) _h["Figure_19_kaon_1"]->fill(p.pT()/GeV, pt_weight); // 70-80% centrality
-            }
+          if(kplus.index(partPt) >= 0){  //all histograms of the figure share the pT binning
 
-            if (p.pid() == 321) { //kaon- (KMINUS Pdgid = -321)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 5.0) _h["Figure_19_kaon_18"]->fill(p.pT()/GeV, pt_weight); // 0-5% centrality
-              if (c > 5.0 && c < 10.0) _h["Figure_19_kaon_17"]->fill(p.pT()/GeV, pt_weight); // 5-10% centrality
-              if (c > 10.0 && c < 20.0) _h["Figure_19_kaon_16"]->fill(p.pT()/GeV, pt_weight); // 10-20% centrality
-              if (c > 20.0 && c < 30.0) _h["Figure_19_kaon_15"]->fill(p.pT()/GeV, pt_weight); // 20-30% centrality
-              if (c > 30.0 && c < 40.0) _h["Figure_19_kaon_14"]->fill(p.pT()/GeV, pt_weight); // 30-40% centrality
-              if (c > 40.0 && c < 50.0) _h["Figure_19_kaon_13"]->fill(p.pT()/GeV, pt_weight); // 40-50% centrality
-              if (c > 50.0 && c < 60.0) _h["Figure_19_kaon_12"]->fill(p.pT()/GeV, pt_weight); // 50-60% centrality
-              if (c > 60.0 && c < 70.0) _h["Figure_19_kaon_11"]->fill(p.pT()/GeV, pt_weight); // 60-70% centrality
-              if (c > 70.0 && c < 80.0) _h["Figure_19_kaon_10"]->fill(p.pT()/GeV, pt_weight); // 70-80% centrality
-            }
+            if (p.pid() == -321) kplus.fill(partPt); //kaon+ (KPLUS Pdgid = 321)
+            if (p.pid() == 321) kminus.fill(partPt); //kaon- (KMINUS Pdgid = -321)
 
           }
 
-          if(getDeltaPt(*_h["Figure_19_pion_1"], partPt, deltaPt)){  //line from Antonio for filling with pT bin center (all have same bin width)
+          if(piplus.index(partPt) >= 0){  //all histograms of the figure share the pT binning
 
             if (p.pid() == -211 && p.parents()[0].abspid() != 3122 && p.parents()[0].abspid() != 310 && p.parents()[0].abspid() != 13) { //pion+ (PIPLUS Pdgid = 211)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 5.0) _h["Figure_19_pion_9"]->fill(p.pT()/GeV, pt_weight); // 0-5% centrality
-              if (c > 5.0 && c < 10.0) _h["Figure_19_pion_8"]->fill(p.pT()/GeV, pt_weight); // 5-10% centrality
-              if (c > 10.0 && c < 20.0) _h["Figure_19_pion_7"]->fill(p.pT()/GeV, pt_weight); // 10-20% centrality
-              if (c > 20.0 && c < 30.0) _h["Figure_19_pion_6"]->fill(p.pT()/GeV, pt_weight); // 20-30% centrality
-              if (c > 30.0 && c < 40.0) _h["Figure_19_pion_5"]->fill(p.pT()/GeV, pt_weight); // 30-40% centrality
-              if (c > 40.0 && c < 50.0) _h["Figure_19_pion_4"]->fill(p.pT()/GeV, pt_weight); // 40-50% centrality
-              if (c > 50.0 && c < 60.0) _h["Figure_19_pion_3"]->fill(p.pT()/GeV, pt_weight); // 50-60% centrality
-              if (c > 60.0 && c < 70.0) _h["Figure_19_pion_2"]->fill(p.pT()/GeV, pt_weight); // 60-70% centrality
-              if (c > 70.0 && c < 80.0) _h["Figure_19_pion_1"]->fill(p.pT()/GeV, pt_weight); // 70-80% centrality
+              piplus.fill(partPt);
             }
             if (p.pid() == 211 && p.parents()[0].abspid() != 3122 && p.parents()[0].abspid() != 310 && p.parents()[0].abspid() != 13) { //pion- (PIMINUS Pdgis = -211)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 5.0) _h["Figure_19_pion_18"]->fill(p.pT()/GeV, pt_weight); // 0-5% centrality
-              if (c > 5.0 && c < 10.0) _h["Figure_19_pion_17"]->fill(p.pT()/GeV, pt_weight); // 5-10% centrality
-              if (c > 10.0 && c < 20.0) _h["Figure_19_pion_16"]->fill(p.pT()/GeV, pt_weight); // 10-20% centrality
-              if (c > 20.0 && c < 30.0) _h["Figure_19_pion_15"]->fill(p.pT()/GeV, pt_weight); // 20-30% centrality
-              if (c > 30.0 && c < 40.0) _h["Figure_19_pion_14"]->fill(p.pT()/GeV, pt_weight); // 30-40% centrality
-              if (c > 40.0 && c < 50.0) _h["Figure_19_pion_13"]->fill(p.pT()/GeV, pt_weight); // 40-50% centrality
-              if (c > 50.0 && c < 60.0) _h["Figure_19_pion_12"]->fill(p.pT()/GeV, pt_weight); // 50-60% centrality
-              if (c > 60.0 && c < 70.0) _h["Figure_19_pion_11"]->fill(p.pT()/GeV, pt_weight); // 60-70% centrality
-              if (c > 70.0 && c < 80.0) _h["Figure_19_pion_10"]->fill(p.pT()/GeV, pt_weight); // 70-80% centrality
+              piminus.fill(partPt);
             }
 
           }
 
-          if(getDeltaPt(*_h["Figure_19_proton_1"], partPt, deltaPt)){  //line from Antonio for filling with pT bin center (all have same bin width)
+          if(pplus.index(partPt) >= 0){  //all histograms of the figure share the pT binning
 
-            if (p.pid() == -2212) { //proton+ (PROTON Pdgid = 2212)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 5.0) _h["Figure_19_proton_9"]->fill(p.pT()/GeV, pt_weight); // 0-5% centrality
-              if (c > 5.0 && c < 10.0) _h["Figure_19_proton_8"]->fill(p.pT()/GeV, pt_weight); // 5-10% centrality
-              if (c > 10.0 && c < 20.0) _h["Figure_19_proton_7"]->fill(p.pT()/GeV, pt_weight); // 10-20% centrality
-              if (c > 20.0 && c < 30.0) _h["Figure_19_proton_6"]->fill(p.pT()/GeV, pt_weight); // 20-30% centrality
-              if (c > 30.0 && c < 40.0) _h["Figure_19_proton_5"]->fill(p.pT()/GeV, pt_weight); // 30-40% centrality
-              if (c > 40.0 && c < 50.0) _h["Figure_19_proton_4"]->fill(p.pT()/GeV, pt_weight); // 40-50% centrality
-              if (c > 50.0 && c < 60.0) _h["Figure_19_proton_3"]->fill(p.pT()/GeV, pt_weight); // 50-60% centrality
-              if (c > 60.0 && c < 70.0) _h["Figure_19_proton_2"]->fill(p.pT()/GeV, pt_weight); // 60-70% centrality
-              if (c > 70.0 && c < 80.0) _h["Figure_19_proton_1"]->fill(p.pT()/GeV, pt_weight); // 70-80% centrality
-            }
-            if (p.pid() == 2212) { //proton- (ANTIPROTON Pdgid = -2212)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 5.0) _h["Figure_19_proton_18"]->fill(p.pT()/GeV, pt_weight); // 0-5% centrality
-              if (c > 5.0 && c < 10.0) _h["Figure_19_proton_17"]->fill(p.pT()/GeV, pt_weight); // 5-10% centrality
-              if (c > 10.0 && c < 20.0) _h["Figure_19_proton_16"]->fill(p.pT()/GeV, pt_weight); // 10-20% centrality
-              if (c > 20.0 && c < 30.0) _h["Figure_19_proton_15"]->fill(p.pT()/GeV, pt_weight); // 20-30% centrality
-              if (c > 30.0 && c < 40.0) _h["Figure_19_proton_14"]->fill(p.pT()/GeV, pt_weight); // 30-40% centrality
-              if (c > 40.0 && c < 50.0) _h["Figure_19_proton_13"]->fill(p.pT()/GeV, pt_weight); // 40-50% centrality
-              if (c > 50.0 && c < 60.0) _h["Figure_19_proton_12"]->fill(p.pT()/GeV, pt_weight); // 50-60% centrality
-              if (c > 60.0 && c < 70.0) _h["Figure_19_proton_11"]->fill(p.pT()/GeV, pt_weight); // 60-70% centrality
-              if (c > 70.0 && c < 80.0) _h["Figure_19_proton_10"]->fill(p.pT()/GeV, pt_weight); // 70-80% centrality
-            }
+            if (p.pid() == -2212) pplus.fill(partPt); //proton+ (PROTON Pdgid = 2212)
+            if (p.pid() == 2212) pminus.fill(partPt); //proton- (ANTIPROTON Pdgid = -2212)
 
           }
 
@@ -665,36 +574,25 @@ namespace Rivet {
       //Figure 20 AuAu @ 130 GeV
       if (collSys == AuAu130)
       {
+        const int ic = CentAuAu130.index(c);
+        if(ic < 0) return;
+        _sowAuAu130[ic]->fill();
+
+        //Histograms of the centrality class of the event, 0-6% is the highest number in the figure
+        const InvariantYield& piplus = _y["Figure_20_" + std::to_string(8 - ic)];
+        const InvariantYield& piminus = _y["Figure_20_" + std::to_string(16 - ic)];
+
         for (const Particle& p : fsParticles) {
 
-          //for filling pT bin center
           double partPt = p.pT()/GeV;
-          double OneOver2pi = 1./(2.*M_PI);
-          double deltaPt = 0.;
 
-          if(getDeltaPt(*_h["Figure_20_1"], partPt, deltaPt)){  //line from Antonio for filling with pT bin center
+          if(piplus.index(partPt) >= 0){  //all histograms of the figure share the pT binning
 
             if (p.pid() == -211 && p.parents()[0].abspid() != 3122 && p.parents()[0].abspid() != 310 && p.parents()[0].abspid() != 13) { //pion+ (PIPLUS Pdgid = 211)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 6.0) _h["Figure_20_8"]->fill(p.pT()/GeV, pt_weight); // 0-6% centrality
-              if (c > 6.0 && c < 11.0) _h["Figure_20_7"]->fill(p.pT()/GeV, pt_weight); // 6-11% centrality
-              if (c > 11.0 && c < 18.0) _h["Figure_20_6"]->fill(p.pT()/GeV, pt_weight); // 11-18% centrality
-              if (c > 18.0 && c < 26.0) _h["Figure_20_5"]->fill(p.pT()/GeV, pt_weight); // 18-26% centrality
-              if (c > 26.0 && c < 34.0) _h["Figure_20_4"]->fill(p.pT()/GeV, pt_weight); // 26-34% centrality
-              if (c > 34.0 && c < 45.0) _h["Figure_20_3"]->fill(p.pT()/GeV, pt_weight); // 34-45% centrality
-              if (c > 45.0 && c < 58.0) _h["Figure_20_2"]->fill(p.pT()/GeV, pt_weight); // 45-58% centrality
-              if (c > 58.0 && c < 85.0) _h["Figure_20_1"]->fill(p.pT()/GeV, pt_weight); // 58-85% centrality
+              piplus.fill(partPt);
             }
             if (p.pid() == 211 && p.parents()[0].abspid() != 3122 && p.parents()[0].abspid() != 310 && p.parents()[0].abspid() != 13) { //pion- (PIMINUS Pdgis = -211)
-              double pt_weight = OneOver2pi/deltaPt; //divide by the ben center (the above should ALWAYS return true)
-              if (c < 6.0) _h["Figure_20_16"]->fill(p.pT()/GeV, pt_weight); // 0-6% centrality
-              if (c > 6.0 && c < 11.0) _h["Figure_20_15"]->fill(p.pT()/GeV, pt_weight); // 6-11% centrality
-              if (c > 11.0 && c < 18.0) _h["Figure_20_14"]->fill(p.pT()/GeV, pt_weight); // 11-18% centrality
-              if (c > 18.0 && c < 26.0) _h["Figure_20_13"]->fill(p.pT()/GeV, pt_weight); // 18-26% centrality
-              if (c > 26.0 && c < 34.0) _h["Figure_20_12"]->fill(p.pT()/GeV, pt_weight); // 26-34% centrality
-              if (c > 34.0 && c < 45.0) _h["Figure_20_11"]->fill(p.pT()/GeV, pt_weight); // 34-45% centrality
-              if (c > 45.0 && c < 58.0) _h["Figure_20_10"]->fill(p.pT()/GeV, pt_weight); // 45-58% centrality
-              if (c > 58.0 && c < 85.0) _h["Figure_20_9"]->fill(p.pT()/GeV, pt_weight); // 58-85% centrality
+              piminus.fill(partPt);
             }
           }
 
@@ -814,8 +712,10 @@ namespace Rivet {
     /// @name Histograms
     //@{
     map<string, Histo1DPtr> _h;
+    map<string, InvariantYield> _y;
     map<string, Profile1DPtr> _p;
     map<string, CounterPtr> _c;
+    vector<CounterPtr> _sowdAu200, _sowAuAu62, _sowAuAu130;
     map<string, Histo2DPtr> _h2D;
     string beamOpt = "";
     //string beam = "";
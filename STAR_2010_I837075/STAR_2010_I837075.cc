@@ -7,6 +7,7 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 #include <iostream>
 
 namespace Rivet {
@@ -22,7 +23,7 @@ namespace Rivet {
 
         beamOpt = getOption<string>("beam", "NONE");
 
-    declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+    DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
 
         // ----------------------------------------------------------
         // Cuts used to see if there is a trigger hit in the BBC
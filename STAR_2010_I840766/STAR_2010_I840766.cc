@@ -13,6 +13,8 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/IdentifiedParticles.hh"
 #include <math.h>
 #include <iostream>
 #include <string>
@@ -39,7 +41,7 @@ namespace Rivet {
 		/// Book histograms and initialise projections before the run
 		void init() {
 			beamOpt = getOption<string>("beam", "NONE");
-			declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+			DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
 
 			const FinalState fs(Cuts::abseta < 1.0);
 			declare(fs, "fs");
@@ -50,6 +52,11 @@ namespace Rivet {
 			const UnstableParticles up(Cuts::abseta < 1.0); 
 			declare(up, "up");
 
+			// pi0/eta and photons bucketed once per event, instead of a pid test on every particle
+			declare(IdentifiedParticles(up, {111, 221}), "up_id");
+			declare(IdentifiedParticles(pfs, {22}), "pfs_id");
+			declare(IdentifiedParticles(fs, {22}), "fs_id");
+
 			book(_h["Table1"], 1, 1, 2);
 			book(_h["Table2"], 2, 1, 2);
 
@@ -121,89 +128,66 @@ namespace Rivet {
 		/// Perform the per-event analysis
 		void analyze(const Event& event) {
 
-			Particles upParticles = applyProjection<UnstableParticles>(event,"up").particles();
-         Particles promtParticles = applyProjection<PromptFinalState>(event,"pfs").particles();
-         Particles fsParticles = applyProjection<FinalState>(event,"pfs").particles();
+			// 111 = pi0, 221 = eta, 22 = photon
+			const IdentifiedParticles& mesons = apply<IdentifiedParticles>(event,"up_id");
+			const IdentifiedParticles& promptPhotons = apply<IdentifiedParticles>(event,"pfs_id");
+			const IdentifiedParticles& photons = apply<IdentifiedParticles>(event,"fs_id");
 
 			if(beamOpt=="pp")
 			{
 				_c["sow_pp"]->fill();
-				for(const Particle& p : upParticles) 
+				for(const Particle& p : mesons.particles(111))
 				{
-					if(p.pid() == 111) // 111 = pi0, 221 = eta, 22 =? direct photon
-               {
-                  _h["Table1"]->fill(p.pT()/GeV); // cross section for pi0
-                  _h["Table3_pi"]->fill(p.pT()/GeV);
-                  _h["Table5_pp"]->fill(p.pT()/GeV);
-               }  
-
-               if(p.pid() == 221) // 111 = pi0, 221 = eta, 22 =? direct photon
-               {
-                  _h["Table3_eta"]->fill(p.pT()/GeV);
-                  _h["Table6_pp"]->fill(p.pT()/GeV);
-               }
-            }
-            for(const Particle& p : promtParticles) 
-            {
-               if(p.pid() == 22)
-               {
-                  _h["Table10"]->fill(p.pT()/GeV); // cross section for direct gamma
-                  _h["Gamma_prompt_pp"]->fill(p.pT()/GeV);
-               }
-
+					_h["Table1"]->fill(p.pT()/GeV); // cross section for pi0
+					_h["Table3_pi"]->fill(p.pT()/GeV);
+					_h["Table5_pp"]->fill(p.pT()/GeV);
+				}
+				for(const Particle& p : mesons.particles(221))
+				{
+					_h["Table3_eta"]->fill(p.pT()/GeV);
+					_h["Table6_pp"]->fill(p.pT()/GeV);
+				}
+				for(const Particle& p : promptPhotons.particles(22))
+				{
+					_h["Table10"]->fill(p.pT()/GeV); // cross section for direct gamma
+					_h["Gamma_prompt_pp"]->fill(p.pT()/GeV);
+				}
+				for(const Particle& p : photons.particles(22))
+				{
+					_h["Gamma_inclusive_pp"]->fill(p.pT()/GeV);
 				}
-            for(const Particle& p : fsParticles) 
-            {
-               if(p.pid() == 22)
-               {
-                  _h["Gamma_inclusive_pp"]->fill(p.pT()/GeV);
-               }
-
-            }
 				return;
 			}
 			else if(beamOpt=="dAu")
 			{
-            const CentralityProjection& cent = apply<CentralityProjection>(event, "CMULT");
-            const double c = cent();
+				const CentralityProjection& cent = apply<CentralityProjection>(event, "CMULT");
+				const double c = cent();
 
 				_c["sow_dAu"]->fill();
-				for(const Particle& p : upParticles) 
+				for(const Particle& p : mesons.particles(111))
+				{
+					_h["Table2"]->fill(p.pT()/GeV); // cross section for pi0
+					_h["Table4_pi"]->fill(p.pT()/GeV);
+					_h["Table5_dAu"]->fill(p.pT()/GeV);
+					if(c < 20)
+						_h["Table7_Central"]->fill(p.pT()/GeV);
+					else if(c > 40)
+						_h["Table7_Peripheral"]->fill(p.pT()/GeV);
+				}
+				for(const Particle& p : mesons.particles(221))
+				{
+					_h["Table4_eta"]->fill(p.pT()/GeV);
+					_h["Table6_dAu"]->fill(p.pT()/GeV);
+				}
+				for(const Particle& p : promptPhotons.particles(22))
+				{
+					_h["Table11"]->fill(p.pT()/GeV); // cross section for direct gamma
+					_h["Gamma_prompt_dAu"]->fill(p.pT()/GeV);
+				}
+				for(const Particle& p : photons.particles(22))
 				{
-					if(p.pid() == 111)
-               {   
-                  _h["Table2"]->fill(p.pT()/GeV); // cross section for pi0
-                  _h["Table4_pi"]->fill(p.pT()/GeV);
-                  _h["Table5_dAu"]->fill(p.pT()/GeV);
-                  if(c < 20)
-                     _h["Table7_Central"]->fill(p.pT()/GeV);
-                  else if(c > 40)
-                     _h["Table7_Peripheral"]->fill(p.pT()/GeV);
-               }
-                  
-               if(p.pid() == 221) // 111 = pi0, 221 = eta, 22 =? direct photon
-               {
-                  _h["Table4_eta"]->fill(p.pT()/GeV);
-                  _h["Table6_dAu"]->fill(p.pT()/GeV);
-               }
-            }
-            for(const Particle& p : promtParticles) 
-            {
-               if(p.pid() == 22)
-               {
-                  _h["Table11"]->fill(p.pT()/GeV); // cross section for direct gamma
-                  _h["Gamma_prompt_dAu"]->fill(p.pT()/GeV);
-               }
-               
+					_h["Gamma_inclusive_dAu"]->fill(p.pT()/GeV);
 				}
-            for(const Particle& p : fsParticles) 
-            {
-               if(p.pid() == 22)
-               {
-                  _h["Gamma_inclusive_dAu"]->fill(p.pT()/GeV);
-               }
-
-            }
 			}
 		}
 
@@ -11,6 +11,7 @@
 #include "Rivet/Tools/AliceCommon.hh"
 #include "Rivet/Projections/AliceCommon.hh"
 #include "../Centralities/RHICCentrality.hh" //external header for Centrality calculation
+#include "../Centralities/CentralityTable.hh"
 #include <math.h>
 #include <fstream>
 #include <iostream>
@@ -47,7 +48,9 @@ namespace Rivet {
 		else if (beamOpt == "AUAU200") collSys = AuAu200;
 
 
-		if (!(collSys == pp)) declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+		if (!(collSys == pp)) {
+			DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
+		}
 
 
 		book(sow["sow_pp"], "sow_pp");
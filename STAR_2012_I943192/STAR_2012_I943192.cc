@@ -9,6 +9,8 @@
 #include <math.h>
 #include <vector>
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/AncestorFlags.hh"
 #define _USE_MATH_DEFINES
 
 //Christine was here
@@ -159,21 +161,6 @@ namespace Rivet {
         return true;
     }
 
-    bool isSecondary(Particle p)
-    {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-	           p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-	           p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-	           p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-	           p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-	           p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-	           p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-        return true;
-        else return false;
-
-    }
-
     double CalculateVn(YODA::Histo1D& hist, int nth)
     {
         int nBins = hist.numBins();
@@ -328,13 +315,14 @@ namespace Rivet {
 
       const ChargedFinalState cfs(Cuts::abseta < 1.0 && Cuts::pT > 1*GeV && Cuts::abscharge > 0);
       declare(cfs, "CFS");
+      declare(AncestorFlags(), "Ancestry");
       const ChargedFinalState cfsTrig(Cuts::abseta < 1.0 && Cuts::pT > 2*GeV && Cuts::abscharge > 0);
       declare(cfsTrig, "CFSTrig");
 
       // Declare centrality projection
       //LATER FIX TO USE STAR
       //declareCentrality(ALICE::V0MMultiplicity(), "ALICE_2015_PBPBCentrality", "V0M", "V0M");
-      declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
 
       //==================================================
       // Create one correlator for each set of Collisions System / Beam Energy / Centrality Interval / Trigger pT interval / Associated pT interval
@@ -639,13 +627,15 @@ namespace Rivet {
 
     if(isVeto) vetoEvent;
 
+    const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
+
     // loop over charged final state particles
       for(const Particle& pTrig : cfsTrig.particles()) {
 
 	       if(pTrig.pt()/GeV < triggerptMin || pTrig.pt()/GeV > triggerptMax) continue;
 
           //Check if is secondary
-          if(isSecondary(pTrig)) continue;
+          if(ancestry.isSecondary(pTrig)) continue;
 
 		  if( abs(pTrig.pid())==211 || abs(pTrig.pid())==2212 || abs(pTrig.pid())==321){
 
@@ -664,7 +654,7 @@ namespace Rivet {
                 if(isSameParticle(pTrig,pAssoc)) continue;
 
                 //Check if is secondary
-                if(isSecondary(pAssoc)) continue;
+                if(ancestry.isSecondary(pAssoc)) continue;
 
 			  if( abs(pAssoc.pid())==211 || abs(pAssoc.pid())==2212 || abs(pAssoc.pid())==321){
 			    //int mybin = GetTrigBin(pTrig.pt());
@@ -7,6 +7,7 @@
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "Rivet/Projections/UnstableParticles.hh"
 #include "RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
 
 namespace Rivet {
 
@@ -53,7 +54,7 @@ namespace Rivet {
 		// book(_h["Pion"], refname + "_Pion", refdata);
 		// book(_s["KaonOverPion"], refname);
 
-		declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+		DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
 
 		const FinalState fs(Cuts::abseta < 1.0 && Cuts::pT > 0.15*GeV);
 		declare(fs, "fs");
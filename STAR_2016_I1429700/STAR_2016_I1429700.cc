@@ -11,6 +11,8 @@
 #include <vector> 
 
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/AncestorFlags.hh"
 
 #define _USE_MATH_DEFINES
 static const int numTrigPtBins = 8;
@@ -119,21 +121,6 @@ bool CheckCollSystemAndEnergy(string s){ return _collSystemAndEnergy.compare(s)
 	return true;
     }
     
-    bool isSecondary(Particle p)
-    {
-	//return true if is secondary
-	if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-		   p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-	           p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-	           p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-	           p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-	           p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-	           p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-	return true;
-        else return false;
-        
-    }
-
 	double CalculateVn(YODA::Histo1D& hist, int nth)
     {
           int nBins = hist.numBins();
@@ -227,6 +214,7 @@ double EtaEffCorrection(double deltaEta, YODA::Histo1D& hist)
      
       const ChargedFinalState cfs(Cuts::pT > 1*GeV); //Not cutting in eta, so no need to correct for pair acceptance
       declare(cfs, "CFS");
+      declare(AncestorFlags(), "Ancestry");
       const ChargedFinalState cfsTrig(Cuts::abseta < 1.0 && Cuts::pT > 2*GeV);
       declare(cfsTrig, "CFSTrig");
       
@@ -234,7 +222,7 @@ double EtaEffCorrection(double deltaEta, YODA::Histo1D& hist)
       // Declare centrality projection
       //LATER FIX TO USE STAR
       //declareCentrality(ALICE::V0MMultiplicity(), "ALICE_2015_PBPBCentrality", "V0M", "V0M");
-      declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
       
 
 
@@ -986,6 +974,8 @@ if(corr.GetTriggerRangeMin() < triggerptMin) triggerptMin = corr.GetTriggerRange
     
     if(isVeto) vetoEvent;
 
+    const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
+
 // loop over charged final state particles
 for(const Particle& pTrig : cfsTrig.particles()) {
 
@@ -993,7 +983,7 @@ for(const Particle& pTrig : cfsTrig.particles()) {
 
 //Check if is secondary
 
-if(isSecondary(pTrig)) continue;
+if(ancestry.isSecondary(pTrig)) continue;
           
 		  if( abs(pTrig.pid())==211 || abs(pTrig.pid())==2212 || abs(pTrig.pid())==321){
 
@@ -1011,7 +1001,7 @@ if(isSecondary(pTrig)) continue;
 if(isSameParticle(pTrig,pAssoc)) continue;
 
 //Check if is secondary
-if(isSecondary(pAssoc)) continue;
+if(ancestry.isSecondary(pAssoc)) continue;
                 
 			  if( abs(pAssoc.pid())==211 || abs(pAssoc.pid())==2212 || abs(pAssoc.pid())==321){
 //int mybin = GetTrigBin(pTrig.pt());
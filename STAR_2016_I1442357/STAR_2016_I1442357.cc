@@ -11,6 +11,8 @@
 #include <math.h>
 #include <vector> 
 #include "../Centralities/RHICCentrality.hh"
+#include "../Centralities/CentralityTable.hh"
+#include "../Spectra/AncestorFlags.hh"
 #define _USE_MATH_DEFINES
 
 using namespace std;
@@ -137,21 +139,6 @@ namespace Rivet {
     }
 
 
-    bool isSecondary(Particle p)
-    {
-        //return true if is secondary
-        if (( p.hasAncestor(310) || p.hasAncestor(-310)  ||     // K0s
-             p.hasAncestor(130)  || p.hasAncestor(-130)  ||     // K0l
-             p.hasAncestor(3322) || p.hasAncestor(-3322) ||     // Xi0
-             p.hasAncestor(3122) || p.hasAncestor(-3122) ||     // Lambda
-             p.hasAncestor(3222) || p.hasAncestor(-3222) ||     // Sigma+/-
-             p.hasAncestor(3312) || p.hasAncestor(-3312) ||     // Xi-/+
-             p.hasAncestor(3334) || p.hasAncestor(-3334) ))    // Omega-/+
-        return true;
-        else return false;
-        
-    }
-
 double CalculateVn(YODA::Histo1D& hist, int nth)
     {
         int nBins = hist.numBins();
@@ -325,6 +312,7 @@ double CalculateVn(YODA::Histo1D& hist, int nth)
 
       const ChargedFinalState cfs(Cuts::abseta < 1.0 && Cuts::pT > 1*GeV);
       declare(cfs, "CFS");
+      declare(AncestorFlags(), "Ancestry");
       const ChargedFinalState cfsTrig(Cuts::abseta < 1.0 && Cuts::pT > 2*GeV);
       declare(cfsTrig, "CFSTrig");
       // FinalState of prompt photons and bare muons and electrons in the event
@@ -347,7 +335,7 @@ double CalculateVn(YODA::Histo1D& hist, int nth)
 
 
       // Declare centrality projection
-      declareCentrality(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT", "CMULT");
+      DECLARE_RHIC_CENTRALITY(RHICCentrality("STAR"), "RHIC_2019_CentralityCalibration:exp=STAR", "CMULT");
 
 
       //==================================================
@@ -718,6 +706,8 @@ double CalculateVn(YODA::Histo1D& hist, int nth)
     }
     
     if(isVeto) vetoEvent;
+
+    const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
     
     //PHOTON
     // loop over charged final state particles
@@ -726,7 +716,7 @@ double CalculateVn(YODA::Histo1D& hist, int nth)
         if(pTrig.pt()/GeV < triggerptMin || pTrig.pt()/GeV > triggerptMax) continue;
         
         //Check if is secondary
-        if(isSecondary(pTrig)) continue;
+        if(ancestry.isSecondary(pTrig)) continue;
                       
             for(Correlator& corr : CorrelatorsB)
             {
@@ -750,7 +740,7 @@ double CalculateVn(YODA::Histo1D& hist, int nth)
                 if(isSameParticle(pTrig,pAssoc)) continue;
                 
                 //Check if is secondary
-                if(isSecondary(pAssoc)) continue;
+                if(ancestry.isSecondary(pAssoc)) continue;
                 
                 double dPhi = GetDeltaPhi(pTrig, pAssoc);
                 
@@ -790,7 +780,7 @@ double CalculateVn(YODA::Histo1D& hist, int nth)
         //cout << "pT_trigeer: " << pTrig.pt()/GeV << endl;
         
         //Check if is secondary
-        if(isSecondary(pTrig)) continue;
+        if(ancestry.isSecondary(pTrig)) continue;
                       
             for(Correlator& corr : CorrelatorsB)
             {
@@ -815,7 +805,7 @@ double CalculateVn(YODA::Histo1D& hist, int nth)
                 if(isSameParticle(pTrig,pAssoc)) continue;
                 
                 //Check if is secondary
-                if(isSecondary(pAssoc)) continue;
+                if(ancestry.isSecondary(pAssoc)) continue;
                 
                 double dPhi = GetDeltaPhi(pTrig, pAssoc);
                 
@@ -1,11 +1,13 @@
 // -*- C++ -*-
 #include "Rivet/Analysis.hh"
 #include "Rivet/Projections/FinalState.hh"
+#include "Rivet/Projections/ChargedFinalState.hh"
 #include "Rivet/Projections/FastJets.hh"
 #include "Rivet/Projections/DressedLeptons.hh"
 #include "Rivet/Projections/MissingMomentum.hh"
 #include "Rivet/Projections/PromptFinalState.hh"
 #include "../Centralities/RHICCentrality.hh"
+#include "../UnderlyingEvent/UERegions.hh"
 namespace Rivet {
 
 
@@ -22,28 +24,34 @@ namespace Rivet {
 
     /// Book histograms and initialise projections before the run
     void init() {
-	const FinalState fs(Cuts::abseta < 4.9);
-      //fig2
-      book(_h["Fig2_Toward"], 1, 1, 1);
-      book(_h["Fig2_Away"], 1, 1, 2);
-      book(_h["Fig2_Transverse"], 1, 1, 3);
-      //fig3
-      //book(_h["BBBB"], 3, 1, 1);
-      book(_h["Fig3_Transverse_pt02"], 2, 1, 1);
-      book(_h["Fig3_Transverse_pt05"], 2, 1, 2);
-      //book(_h["Fig3_Transverse"],2,1,3);
-
-      book(_h["Fig4_Toward"], 3, 1, 1);
-      book(_h["Fig4_Away"], 3, 1, 2);
-      book(_h["Fig4_Transverse"], 3, 1, 3);
+      // Jets from charged and neutral particles at mid-rapidity, anti-kT R=0.6
+      const FinalState fs(Cuts::abseta < 1.0 && Cuts::pT > 0.2*GeV);
+      declare(fs, "FS");
+      FastJets jets(fs, FastJets::ANTIKT, 0.6);
+      declare(jets, "Jets");
 
-      book(_h["Fig5_Transverse_pt02"], 4, 1, 1);
-      book(_h["Fig5_Transverse_pt05"], 4, 1, 2);
-      //book(_h["Fig5_Transverse"], 4, 1, 3);
+      // Charged tracks |eta| < 1 in the toward / away / transverse regions of
+      // the leading jet, for track pT > 0.2 and > 0.5 GeV
+      const ChargedFinalState cfs(Cuts::abseta < 1.0 && Cuts::pT > 0.2*GeV);
+      declare(UERegions(cfs, jets, Cuts::abseta < 0.4 && Cuts::pT > _jetPtBins.front()*GeV, {0.2, 0.5}, 2.0), "UE");
 
-      book(_h["Fig6_Transverse_pt02"], 5, 1, 1);
-      book(_h["Fig6_Transverse_pt05"], 5, 1, 2);
-      //book(_h["Fig6_Transverse"], 5, 1, 3);
+      //fig2
+      book(_p["Fig2_Toward"], 1, 1, 1);
+      book(_p["Fig2_Away"], 1, 1, 2);
+      book(_p["Fig2_Transverse"], 1, 1, 3);
+      //fig3
+      book(_p["Fig3_Transverse_pt02"], 2, 1, 1);
+      book(_p["Fig3_Transverse_pt05"], 2, 1, 2);
+      //fig4
+      book(_p["Fig4_Toward"], 3, 1, 1);
+      book(_p["Fig4_Away"], 3, 1, 2);
+      book(_p["Fig4_Transverse"], 3, 1, 3);
+      //fig5
+      book(_p["Fig5_Transverse_pt02"], 4, 1, 1);
+      book(_p["Fig5_Transverse_pt05"], 4, 1, 2);
+      //fig6
+      book(_p["Fig6_TransMax"], 5, 1, 1);
+      book(_p["Fig6_TransMin"], 5, 1, 2);
 
     }
 
@@ -51,19 +59,29 @@ namespace Rivet {
     /// Perform the per-event analysis
     void analyze(const Event& event) {
 
-      // Retrieve dressed leptons, sorted by pT
-
-      // Retrieve clustered jets, sorted by pT, with a minimum pT cut
+      const UERegions& ue = apply<UERegions>(event, "UE");
+      if(!ue.found()) vetoEvent;
 
-      // Remove all jets within dR < 0.2 of a dressed lepton
+      // The reference points are numbered by leading-jet pT class
+      const double x = jetPtClass(ue.leading().pT()/GeV);
+      if(x < 0) vetoEvent;
 
-      // Select jets ghost-associated to B-hadrons with a certain fiducial selection
+      _p["Fig2_Toward"]->fill(x, ue.multDensity(UERegions::TOWARD, 0));
+      _p["Fig2_Away"]->fill(x, ue.multDensity(UERegions::AWAY, 0));
+      _p["Fig2_Transverse"]->fill(x, ue.multDensity(UERegions::TRANSVERSE, 0));
 
-      // Veto event if there are no b-jets
+      _p["Fig3_Transverse_pt02"]->fill(x, ue.multDensity(UERegions::TRANSVERSE, 0));
+      _p["Fig3_Transverse_pt05"]->fill(x, ue.multDensity(UERegions::TRANSVERSE, 1));
 
-      // Apply a missing-momentum cut
+      // Track-averaged <pT>: one entry per region weighted by its multiplicity
+      fillMeanPt("Fig4_Toward", x, ue, UERegions::TOWARD, 0);
+      fillMeanPt("Fig4_Away", x, ue, UERegions::AWAY, 0);
+      fillMeanPt("Fig4_Transverse", x, ue, UERegions::TRANSVERSE, 0);
+      fillMeanPt("Fig5_Transverse_pt02", x, ue, UERegions::TRANSVERSE, 0);
+      fillMeanPt("Fig5_Transverse_pt05", x, ue, UERegions::TRANSVERSE, 1);
 
-      // Fill histogram with leading b-jet pT
+      _p["Fig6_TransMax"]->fill(x, ue.multDensity(UERegions::TRANSMAX, 0));
+      _p["Fig6_TransMin"]->fill(x, ue.multDensity(UERegions::TRANSMIN, 0));
 
     }
 
@@ -71,9 +89,22 @@ namespace Rivet {
     /// Normalise histograms etc., after the run
     void finalize() {
 
+      // Profiles already hold the per-event averages
 
     }
 
+    /// Reference x value (1, 2, ...) of the leading-jet pT class, -1 if outside.
+    double jetPtClass(double jetPt) const {
+      if(jetPt < _jetPtBins.front() || jetPt >= _jetPtBins.back()) return -1;
+      const size_t i = std::upper_bound(_jetPtBins.begin(), _jetPtBins.end(), jetPt) - _jetPtBins.begin();
+      return double(i);
+    }
+
+    void fillMeanPt(const string& name, double x, const UERegions& ue, UERegions::Region region, size_t ithr) {
+      const double n = ue.mult(region, ithr);
+      if(n > 0) _p[name]->fill(x, ue.meanPt(region, ithr), n);
+    }
+
     //@}
 
 
@@ -84,6 +115,9 @@ namespace Rivet {
     map<string, CounterPtr> _c;
     //@}
 
+    /// Leading-jet pT classes (GeV) of the eight reference points
+    const vector<double> _jetPtBins = {11., 15., 20., 25., 30., 35., 40., 45., 55.};
+
 
   };
 
@@ -0,0 +1,137 @@
+// -*- C++ -*-
+#ifndef RIVET_ANCESTORFLAGS_HH
+#define RIVET_ANCESTORFLAGS_HH
+
+#include "Rivet/Projection.hh"
+#include "Rivet/Event.hh"
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Weakly decaying ancestors of every particle in the event record.
+///
+/// Feed-down rejection used to call Particle::hasAncestor once per PDG
+/// code, each call walking the genealogy again, for every trigger and
+/// associated particle. This projection walks the event graph once and
+/// keeps for every particle a bitmask of the species classes found among
+/// its ancestors, so the test is a lookup and a bit test:
+///
+///   const AncestorFlags& ancestry = apply<AncestorFlags>(event, "Ancestry");
+///   if(ancestry.isSecondary(p)) continue;
+///
+/// A class covers particle and antiparticle, and like hasAncestor only
+/// ancestors with status 1 or 2 set their bit.
+class AncestorFlags: public Projection {
+
+public:
+
+  enum Species : uint16_t {
+    K0S        = 1 << 0,  // 310
+    K0L        = 1 << 1,  // 130
+    LAMBDA     = 1 << 2,  // 3122
+    SIGMAPLUS  = 1 << 3,  // 3222
+    SIGMA0     = 1 << 4,  // 3212
+    SIGMAMINUS = 1 << 5,  // 3112
+    XI0        = 1 << 6,  // 3322
+    XIMINUS    = 1 << 7,  // 3312
+    OMEGA      = 1 << 8,  // 3334
+    /// The weak decays rejected by isSecondary in the correlation analyses.
+    WEAK_DECAY = K0S | K0L | LAMBDA | SIGMAPLUS | XI0 | XIMINUS | OMEGA,
+    /// Hyperon feed-down into (anti)protons.
+    HYPERON = LAMBDA | SIGMAPLUS | SIGMA0 | SIGMAMINUS | XI0 | XIMINUS | OMEGA
+  };
+
+  AncestorFlags() {
+    setName("AncestorFlags");
+  }
+
+  DEFAULT_RIVET_PROJ_CLONE(AncestorFlags);
+
+  /// Class bit of @a pid, 0 if it is none of the tracked species.
+  static uint16_t species(PdgId pid) {
+    switch(std::abs(pid))
+    {
+      case 310: return K0S;
+      case 130: return K0L;
+      case 3122: return LAMBDA;
+      case 3222: return SIGMAPLUS;
+      case 3212: return SIGMA0;
+      case 3112: return SIGMAMINUS;
+      case 3322: return XI0;
+      case 3312: return XIMINUS;
+      case 3334: return OMEGA;
+      default: return 0;
+    }
+  }
+
+  /// Classes among the ancestors of @a p, 0 for particles without a
+  /// generator record.
+  uint16_t flags(const Particle& p) const {
+    ConstGenParticlePtr gp = p.genParticle();
+    if(gp == nullptr) return 0;
+    const int i = gp->id() - 1;
+    return (i >= 0 && i < int(_flags.size())) ? _flags[i] : 0;
+  }
+
+  /// True if @a p has an ancestor of one of the classes in @a mask.
+  bool hasAncestor(const Particle& p, uint16_t mask) const { return (flags(p) & mask) != 0; }
+
+  /// True if @a p is feed-down from a strange weak decay.
+  bool isSecondary(const Particle& p) const { return hasAncestor(p, WEAK_DECAY); }
+
+protected:
+
+  /// One pass over the event record, each particle visited once.
+  void project(const Event& e) {
+    const std::vector<ConstGenParticlePtr> particles = HepMCUtils::particles(e.genEvent());
+    _flags.assign(particles.size(), 0);
+    _state.assign(particles.size(), UNVISITED);
+    for(ConstGenParticlePtr gp : particles) visit(gp);
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection&) const {
+    return CmpState::EQ;
+  }
+
+private:
+
+  enum State : char { UNVISITED, ACTIVE, DONE };
+
+  /// Flags of @a gp from those of its parents. Parents usually precede
+  /// their children in the record, so the recursion rarely goes deep; a
+  /// particle met again while its own ancestry is being resolved (a loop
+  /// in a broken record) contributes nothing.
+  uint16_t visit(ConstGenParticlePtr gp) {
+    const int i = gp->id() - 1;
+    if(i < 0 || i >= int(_flags.size())) return 0;
+    if(_state[i] == DONE) return _flags[i];
+    if(_state[i] == ACTIVE) return 0;
+    _state[i] = ACTIVE;
+
+    uint16_t f = 0;
+    ConstGenVertexPtr vtx = gp->production_vertex();
+    if(vtx != nullptr)
+    {
+      for(ConstGenParticlePtr parent : vtx->particles_in())
+      {
+        f |= visit(parent);
+        const int status = parent->status();
+        if(status == 1 || status == 2) f |= species(parent->pdg_id());
+      }
+    }
+    _flags[i] = f;
+    _state[i] = DONE;
+    return f;
+  }
+
+  std::vector<uint16_t> _flags;
+  std::vector<char> _state;
+
+};
+
+}
+
+#endif
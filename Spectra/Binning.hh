@@ -0,0 +1,59 @@
+// -*- C++ -*-
+#ifndef RIVET_BINNING_HH
+#define RIVET_BINNING_HH
+
+#include <cstddef>
+
+namespace Rivet {
+
+/// @brief Bin edges fixed at compile time, for centrality and pT classes.
+///
+/// N bins [edges[i], edges[i+1]) with N+1 ascending edges, uniform or of
+/// variable width. index() compares the value with every edge and counts,
+/// which the compiler unrolls for the small N used for event and particle
+/// classes: no branches and no scan that stops early, so a class is one
+/// lookup instead of an if/else ladder. The edges can be read like the
+/// plain arrays they replace, e.g. CentBins[i] and CentBins[i+1].
+template <size_t N>
+struct Binning {
+
+  double edges[N + 1];
+
+  static constexpr size_t size() { return N; }
+
+  constexpr double operator[](size_t i) const { return edges[i]; }
+
+  constexpr double low(size_t i) const { return edges[i]; }
+  constexpr double high(size_t i) const { return edges[i + 1]; }
+  constexpr double min() const { return edges[0]; }
+  constexpr double max() const { return edges[N]; }
+
+  /// Bin of @a x, -1 below the first edge, from the last edge on, or NaN.
+  constexpr int index(double x) const {
+    int n = 0;
+    for(size_t i = 0; i <= N; i++) n += (x >= edges[i]);
+    return (n > 0 && n <= int(N)) ? n - 1 : -1;
+  }
+
+  constexpr bool contains(double x) const { return x >= edges[0] && x < edges[N]; }
+
+};
+
+
+/// Variable-width binning with the given edges, e.g. makeBinning(0., 5., 10., 20.).
+template <typename... EDGES>
+constexpr Binning<sizeof...(EDGES) - 1> makeBinning(EDGES... edges) {
+  return Binning<sizeof...(EDGES) - 1>{{double(edges)...}};
+}
+
+/// N bins of equal width between @a lo and @a hi.
+template <size_t N>
+constexpr Binning<N> uniformBinning(double lo, double hi) {
+  Binning<N> b{};
+  for(size_t i = 0; i <= N; i++) b.edges[i] = lo + (hi - lo)*i/N;
+  return b;
+}
+
+}
+
+#endif
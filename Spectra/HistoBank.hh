@@ -0,0 +1,48 @@
+// -*- C++ -*-
+#ifndef RIVET_HISTOBANK_HH
+#define RIVET_HISTOBANK_HH
+
+#include "Rivet/Analysis.hh"
+#include <array>
+#include <cstddef>
+
+namespace Rivet {
+
+/// @brief Fixed-shape bank of histograms indexed by [species][class][window].
+///
+/// Replaces a map<string, Histo1DPtr> whose keys spell out the species,
+/// centrality class (or collision system) and rapidity window: the three
+/// axes are enums of the analysis and the histograms live in one flat
+/// array, so a lookup in analyze() is index arithmetic instead of string
+/// compares. Booking is unchanged, book(bank(s, c, y), ...) registers the
+/// YODA path as before. Slots that are never booked stay null.
+template <size_t NSPECIES, size_t NCLASS, size_t NWINDOW = 1, typename HISTO = Histo1DPtr>
+class HistoBank {
+
+public:
+
+  HISTO& operator()(size_t s, size_t c, size_t y = 0) {
+    return _h[(s*NCLASS + c)*NWINDOW + y];
+  }
+
+  const HISTO& operator()(size_t s, size_t c, size_t y = 0) const {
+    return _h[(s*NCLASS + c)*NWINDOW + y];
+  }
+
+  static constexpr size_t size() { return NSPECIES*NCLASS*NWINDOW; }
+
+  /// Iterate over all slots, booked or not.
+  typename std::array<HISTO, NSPECIES*NCLASS*NWINDOW>::iterator begin() { return _h.begin(); }
+  typename std::array<HISTO, NSPECIES*NCLASS*NWINDOW>::iterator end() { return _h.end(); }
+  typename std::array<HISTO, NSPECIES*NCLASS*NWINDOW>::const_iterator begin() const { return _h.begin(); }
+  typename std::array<HISTO, NSPECIES*NCLASS*NWINDOW>::const_iterator end() const { return _h.end(); }
+
+private:
+
+  std::array<HISTO, NSPECIES*NCLASS*NWINDOW> _h;
+
+};
+
+}
+
+#endif
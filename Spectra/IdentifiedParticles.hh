@@ -0,0 +1,118 @@
+// -*- C++ -*-
+#ifndef RIVET_IDENTIFIEDPARTICLES_HH
+#define RIVET_IDENTIFIEDPARTICLES_HH
+
+#include "Rivet/Projection.hh"
+#include "Rivet/Projections/ParticleFinder.hh"
+#include <algorithm>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Particles of a finder bucketed by species in one pass.
+///
+/// The particles of the input with one of the configured PDG codes are
+/// stored grouped by species, in the order of the codes, so the yield of
+/// a species is a count and its particles a span into one list instead of
+/// a filtered copy per species. Particles with other codes are dropped.
+/// Analyses declaring the same input and codes share one projection
+/// through the projection cache, so the bucketing runs once per event for
+/// all of them.
+class IdentifiedParticles: public Projection {
+
+public:
+
+  /// A contiguous range of the bucketed particles.
+  class Span {
+  public:
+    Span(const Particle* b, const Particle* e) : _begin(b), _end(e) { }
+    const Particle* begin() const { return _begin; }
+    const Particle* end() const { return _end; }
+    size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+    const Particle& operator[](size_t i) const { return _begin[i]; }
+  private:
+    const Particle* _begin;
+    const Particle* _end;
+  };
+
+  /// Species @a pids among the particles of @a input passing @a c.
+  IdentifiedParticles(const ParticleFinder& input, const std::vector<PdgId>& pids, const Cut& c = Cuts::open())
+    : _pids(pids), _cuts(c), _offset(pids.size() + 1, 0) {
+    setName("IdentifiedParticles");
+    declare(input, "Input");
+  }
+
+  DEFAULT_RIVET_PROJ_CLONE(IdentifiedParticles);
+
+  /// All particles of the configured species, grouped by species.
+  const Particles& particles() const { return _particles; }
+
+  /// Number of configured species.
+  size_t numSpecies() const { return _pids.size(); }
+
+  /// Index of @a pid among the configured codes, -1 if not configured.
+  int species(PdgId pid) const {
+    for(size_t i = 0; i < _pids.size(); i++) if(_pids[i] == pid) return int(i);
+    return -1;
+  }
+
+  /// Particles of species @a pid, empty if not configured.
+  Span particles(PdgId pid) const { return span(species(pid)); }
+
+  /// Number of particles of species @a pid.
+  size_t size(PdgId pid) const { return span(species(pid)).size(); }
+
+  /// Particles of the species with index @a i.
+  Span span(int i) const {
+    if(i < 0 || _particles.empty()) return Span(nullptr, nullptr);
+    return Span(_particles.data() + _offset[i], _particles.data() + _offset[i + 1]);
+  }
+
+protected:
+
+  void project(const Event& e) {
+    const Particles& input = apply<ParticleFinder>(e, "Input").particles();
+
+    // Classify once, then place every particle after the ones of the
+    // species before it: a counting sort with a single copy.
+    _index.clear();
+    std::fill(_offset.begin(), _offset.end(), 0);
+    for(const Particle& p : input)
+    {
+        const int i = _cuts->accept(p) ? species(p.pid()) : -1;
+        _index.push_back(i);
+        if(i >= 0) _offset[i + 1]++;
+    }
+    for(size_t i = 1; i < _offset.size(); i++) _offset[i] += _offset[i - 1];
+
+    _particles.resize(_offset.back());
+    std::vector<size_t> next(_offset.begin(), _offset.end() - 1);
+    for(size_t j = 0; j < input.size(); j++)
+    {
+        if(_index[j] >= 0) _particles[next[_index[j]]++] = input[j];
+    }
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection& p) const {
+    const IdentifiedParticles& other = dynamic_cast<const IdentifiedParticles&>(p);
+    if(_pids != other._pids || !(_cuts == other._cuts)) return CmpState::NEQ;
+    return mkNamedPCmp(p, "Input");
+  }
+
+private:
+
+  std::vector<PdgId> _pids;
+  Cut _cuts;
+
+  /// Species i owns _particles[_offset[i], _offset[i+1]).
+  Particles _particles;
+  std::vector<size_t> _offset;
+  std::vector<int> _index;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,73 @@
+// -*- C++ -*-
+#ifndef RIVET_INVARIANTYIELD_HH
+#define RIVET_INVARIANTYIELD_HH
+
+#include "Rivet/Analysis.hh"
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Invariant-yield filler for a booked pT histogram.
+///
+/// Fills 1/(2pi pT dy) dN/dpT with the pT of every entry taken at its bin
+/// centre, i.e. with weight 1/(2pi pT_centre dy). The bin edges and
+/// weights are read from the histogram once, after booking in init(), so
+/// a fill is one lookup in the edges and one weighted fill instead of a
+/// copy of the histogram to find the bin.
+class InvariantYield {
+
+public:
+
+  InvariantYield() { }
+
+  /// Filler for @a hist, a yield per @a dy units of rapidity.
+  explicit InvariantYield(Histo1DPtr hist, double dy = 1.) : _hist(hist) {
+    for(const YODA::HistoBin1D& b : hist->bins())
+    {
+        _low.push_back(b.xMin());
+        _high.push_back(b.xMax());
+        _weight.push_back(1./(2.*M_PI*b.xMid()*dy));
+    }
+  }
+
+  /// Bin of @a pT, -1 outside the histogram or in a gap between bins.
+  int index(double pT) const {
+    if(_low.empty() || !(pT > _low.front() && pT < _high.back())) return -1;
+    const int i = int(std::upper_bound(_low.begin(), _low.end(), pT) - _low.begin()) - 1;
+    return pT < _high[i] ? i : -1;
+  }
+
+  /// Fill @a pT with weight @a w/(2pi pT_centre dy); false if outside.
+  bool fill(double pT, double w = 1.) const {
+    const int i = index(pT);
+    if(i < 0) return false;
+    _hist->fill(pT, w*_weight[i]);
+    return true;
+  }
+
+  /// The bin-centre weight 1/(2pi pT_centre dy) of bin @a i.
+  double weight(int i) const { return _weight[i]; }
+
+  Histo1DPtr histo() const { return _hist; }
+
+private:
+
+  Histo1DPtr _hist;
+  std::vector<double> _low, _high, _weight;
+
+};
+
+
+/// Fillers for all histograms in @a hists, under the same names.
+inline std::map<std::string, InvariantYield> invariantYields(const std::map<std::string, Histo1DPtr>& hists, double dy = 1.) {
+  std::map<std::string, InvariantYield> yields;
+  for(const auto& h : hists) yields.emplace(h.first, InvariantYield(h.second, dy));
+  return yields;
+}
+
+}
+
+#endif
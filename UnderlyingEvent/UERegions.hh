@@ -0,0 +1,192 @@
+// -*- C++ -*-
+#ifndef RIVET_UEREGIONS_HH
+#define RIVET_UEREGIONS_HH
+
+#include "Rivet/Projection.hh"
+#include "Rivet/Projections/ParticleFinder.hh"
+#include "Rivet/Projections/FastJets.hh"
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace Rivet {
+
+/// @brief Toward / away / transverse underlying-event regions.
+///
+/// The leading jet (or, without a jet projection, the leading track) is
+/// found once per event. Every track is then assigned to one region from
+/// its azimuthal distance to the leading object,
+///   |dphi| < pi/3 toward, |dphi| > 2pi/3 away, transverse in between,
+/// with the two transverse sides ordered into TransMax / TransMin by their
+/// multiplicity. Multiplicity and scalar pT sum are accumulated per region
+/// and per track-pT threshold in the same pass, so analyses only read the
+/// region sums.
+class UERegions: public Projection {
+
+public:
+
+  enum Region { TOWARD = 0, AWAY, TRANSMAX, TRANSMIN, TRANSVERSE, NREGIONS };
+
+  /// Regions around the leading jet of @a jets passing @a jetCut, filled
+  /// with the tracks of @a tracks above each of the pT @a thresholds.
+  /// @a etaWidth is the full pseudorapidity range of the tracks.
+  UERegions(const ParticleFinder& tracks, const FastJets& jets, const Cut& jetCut,
+            const std::vector<double>& thresholds, double etaWidth)
+    : _jetCut(jetCut), _useJets(true), _thresholds(thresholds), _etaWidth(etaWidth) {
+    setName("UERegions");
+    declare(tracks, "Tracks");
+    declare(jets, "Jets");
+  }
+
+  /// Regions around the leading track of @a tracks.
+  UERegions(const ParticleFinder& tracks, const std::vector<double>& thresholds, double etaWidth)
+    : _jetCut(Cuts::open()), _useJets(false), _thresholds(thresholds), _etaWidth(etaWidth) {
+    setName("UERegions");
+    declare(tracks, "Tracks");
+  }
+
+  DEFAULT_RIVET_PROJ_CLONE(UERegions);
+
+  /// Whether a leading object was found in this event.
+  bool found() const { return _found; }
+
+  /// The leading jet or track.
+  const FourMomentum& leading() const { return _leading; }
+
+  size_t numThresholds() const { return _thresholds.size(); }
+
+  /// Number of tracks above threshold @a ithr in @a region.
+  double mult(Region region, size_t ithr) const { return _mult[ithr][region]; }
+
+  /// Scalar pT sum of the tracks above threshold @a ithr in @a region.
+  double sumPt(Region region, size_t ithr) const { return _sumPt[ithr][region]; }
+
+  /// Mean track pT in @a region, 0 if the region is empty.
+  double meanPt(Region region, size_t ithr) const {
+    return _mult[ithr][region] > 0 ? _sumPt[ithr][region]/_mult[ithr][region] : 0.;
+  }
+
+  /// Azimuthal width of @a region: 2pi/3, or pi/3 for each transverse side.
+  static double dPhiWidth(Region region) {
+    return (region == TRANSMAX || region == TRANSMIN) ? M_PI/3. : 2.*M_PI/3.;
+  }
+
+  /// Multiplicity density dN/deta dphi in @a region.
+  double multDensity(Region region, size_t ithr) const {
+    return mult(region, ithr)/(_etaWidth*dPhiWidth(region));
+  }
+
+  /// Scalar pT density dsumPt/deta dphi in @a region.
+  double sumPtDensity(Region region, size_t ithr) const {
+    return sumPt(region, ithr)/(_etaWidth*dPhiWidth(region));
+  }
+
+protected:
+
+  void project(const Event& e) {
+    const size_t nthr = _thresholds.size();
+    _mult.assign(nthr, {});
+    _sumPt.assign(nthr, {});
+    _found = false;
+
+    const Particles& tracks = apply<ParticleFinder>(e, "Tracks").particles();
+
+    if(_useJets)
+    {
+      const Jets jets = apply<FastJets>(e, "Jets").jetsByPt(_jetCut);
+      if(jets.empty()) return;
+      _leading = jets[0].momentum();
+    }
+    else
+    {
+      if(tracks.empty()) return;
+      const Particle* lead = &tracks[0];
+      for(const Particle& p : tracks) if(p.pT() > lead->pT()) lead = &p;
+      _leading = lead->momentum();
+    }
+    _found = true;
+
+    // Flat copies so the classification loop below does pure arithmetic
+    const size_t n = tracks.size();
+    _pt.resize(n);
+    _phi.resize(n);
+    for(size_t i = 0; i < n; i++)
+    {
+      _pt[i] = tracks[i].pT();
+      _phi[i] = tracks[i].phi();
+    }
+
+    // Region code: 0 toward, 1 away, 2 transverse side A, 3 transverse side B
+    const double phiLead = _leading.phi();
+    _code.resize(n);
+    for(size_t i = 0; i < n; i++)
+    {
+      double dphi = _phi[i] - phiLead;
+      dphi -= 2.*M_PI*std::floor((dphi + M_PI)/(2.*M_PI));
+      const double adphi = std::fabs(dphi);
+      const int away = adphi > 2.*M_PI/3.;
+      const int trans = (adphi >= M_PI/3.) & !away;
+      _code[i] = away + trans*(2 + (dphi < 0.));
+    }
+
+    // Side A/B sums, sorted into TransMax/TransMin below
+    for(size_t i = 0; i < n; i++)
+    {
+      for(size_t ithr = 0; ithr < nthr; ithr++)
+      {
+        if(_pt[i] <= _thresholds[ithr]) continue;
+        _mult[ithr][_code[i]] += 1.;
+        _sumPt[ithr][_code[i]] += _pt[i];
+      }
+    }
+
+    for(size_t ithr = 0; ithr < nthr; ithr++)
+    {
+      std::array<double, NREGIONS>& m = _mult[ithr];
+      std::array<double, NREGIONS>& s = _sumPt[ithr];
+      m[TRANSVERSE] = m[TRANSMAX] + m[TRANSMIN];
+      s[TRANSVERSE] = s[TRANSMAX] + s[TRANSMIN];
+      if(m[TRANSMIN] > m[TRANSMAX] || (m[TRANSMIN] == m[TRANSMAX] && s[TRANSMIN] > s[TRANSMAX]))
+      {
+        std::swap(m[TRANSMAX], m[TRANSMIN]);
+        std::swap(s[TRANSMAX], s[TRANSMIN]);
+      }
+    }
+  }
+
+  /// Compare projections.
+  CmpState compare(const Projection& p) const {
+    const UERegions& other = dynamic_cast<const UERegions&>(p);
+    if(_useJets != other._useJets) return CmpState::NEQ;
+    if(_thresholds != other._thresholds || _etaWidth != other._etaWidth) return CmpState::NEQ;
+    if(_useJets)
+    {
+      if(!(_jetCut == other._jetCut)) return CmpState::NEQ;
+      return mkNamedPCmp(p, "Tracks") || mkNamedPCmp(p, "Jets");
+    }
+    return mkNamedPCmp(p, "Tracks");
+  }
+
+private:
+
+  Cut _jetCut;
+  bool _useJets;
+  std::vector<double> _thresholds;
+  double _etaWidth;
+
+  bool _found = false;
+  FourMomentum _leading;
+
+  /// Per threshold, per region multiplicity and pT sum.
+  std::vector<std::array<double, NREGIONS>> _mult;
+  std::vector<std::array<double, NREGIONS>> _sumPt;
+
+  /// Scratch arrays of the classification pass.
+  std::vector<double> _pt, _phi;
+  std::vector<int> _code;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,156 @@
+// -*- C++ -*-
+#ifndef RIVET_CHECKPOINT_HH
+#define RIVET_CHECKPOINT_HH
+
+#include "Rivet/AnalysisHandler.hh"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace Rivet {
+
+/// @brief Periodic snapshots of a running AnalysisHandler, and resuming.
+///
+/// Every @a every events the process forks: the child holds a copy of the
+/// analysis state as it was at that event, finalizes it, writes it with
+/// its raw objects to a temporary file and renames that to PATH, so that PATH is
+/// always a complete file; the parent goes on with the next event at once.
+/// A snapshot is skipped while the previous one is still being written.
+/// The snapshot is an ordinary Rivet output, so a job killed at its wall
+/// time leaves PATH as a partial result that rivet-merge -e can combine.
+/// A name ending in .yoda.gz writes it compressed.
+///
+/// With resume, the snapshot of an earlier, killed job is kept as PATH.1,
+/// PATH.2, ... (numbered before the .yoda extension) and merged into the
+/// output by finish(), so that a restarted job (e.g. with new generator
+/// seeds) appends to the statistics of the jobs before it:
+///
+///   Checkpoint checkpoint("Rivet.ckpt.yoda", 10000, true);
+///   ... ah.analyze(ge); checkpoint.event(ah); ...
+///   ah.finalize(); ah.writeData(output);
+///   checkpoint.finish(output);
+class Checkpoint {
+
+public:
+
+  Checkpoint(const std::string& path, long every, bool resume)
+    : _path(path), _every(every) {
+    for(int k = 1; ; k++)
+    {
+        const std::string part = partName(k);
+        if(exists(part))
+        {
+            _parts.push_back(part);
+            continue;
+        }
+        if(!exists(_path)) break;
+        if(!resume)
+          throw std::runtime_error("Checkpoint: " + _path + " exists; resume from it or remove it");
+        if(std::rename(_path.c_str(), part.c_str()) != 0)
+          throw std::runtime_error("Checkpoint: cannot move " + _path + " to " + part);
+        _parts.push_back(part);
+        break;
+    }
+    if(!_parts.empty() && !resume)
+      throw std::runtime_error("Checkpoint: " + _parts.front() + " exists; resume from it or remove it");
+    for(const std::string& part : _parts) std::cout << "Resuming from " << part << std::endl;
+  }
+
+  ~Checkpoint() { wait(); }
+
+  Checkpoint(const Checkpoint&) = delete;
+  Checkpoint& operator=(const Checkpoint&) = delete;
+
+  /// Call after every event.
+  void event(AnalysisHandler& ah) {
+    if(_every <= 0 || ++_nEvents % _every != 0) return;
+    if(_writer > 0)
+    {
+        // Reap the previous snapshot, and skip this one if it is still running
+        if(waitpid(_writer, nullptr, WNOHANG) == 0) return;
+        _writer = 0;
+    }
+    std::cout.flush();
+    std::cerr.flush();
+    const pid_t pid = fork();
+    if(pid < 0) return;
+    if(pid > 0)
+    {
+        _writer = pid;
+        return;
+    }
+    int status = 0;
+    try
+    {
+        const std::string tmp = partName("tmp");
+        ah.finalize();
+        ah.writeData(tmp);
+        if(std::rename(tmp.c_str(), _path.c_str()) != 0) status = 1;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "Checkpoint: " << e.what() << std::endl;
+        status = 1;
+    }
+    _exit(status);
+  }
+
+  /// Wait for the snapshot being written, if any.
+  void wait() {
+    if(_writer > 0) waitpid(_writer, nullptr, 0);
+    _writer = 0;
+  }
+
+  /// After the complete @a output has been written: merge the snapshots of
+  /// earlier jobs into it and remove them and the last snapshot.
+  void finish(const std::string& output, bool pwd = false) {
+    wait();
+    if(!_parts.empty())
+    {
+        const std::string merged = output + ".merged.yoda";
+        std::string merge = "rivet-merge -e";
+        if(pwd) merge += " --pwd";
+        merge += " -o " + quote(merged) + " " + quote(output);
+        for(const std::string& part : _parts) merge += " " + quote(part);
+        if(std::system(merge.c_str()) != 0 || std::rename(merged.c_str(), output.c_str()) != 0)
+          throw std::runtime_error("Checkpoint: " + merge + " failed, the earlier snapshots are kept");
+        for(const std::string& part : _parts) std::remove(part.c_str());
+    }
+    std::remove(_path.c_str());
+  }
+
+private:
+
+  std::string partName(int k) const { return partName(std::to_string(k)); }
+
+  /// PATH with @a tag before the extension, so that YODA recognises the format.
+  std::string partName(const std::string& tag) const {
+    const size_t dot = _path.find(".yoda");
+    const std::string suffix = "." + tag;
+    return dot == std::string::npos ? _path + suffix : _path.substr(0, dot) + suffix + _path.substr(dot);
+  }
+
+  static bool exists(const std::string& path) { return access(path.c_str(), F_OK) == 0; }
+
+  static std::string quote(const std::string& s) {
+    std::string q = "'";
+    for(char c : s) q += (c == '\'') ? std::string("'\\''") : std::string(1, c);
+    return q + "'";
+  }
+
+  std::string _path;
+  long _every;
+  long _nEvents = 0;
+  pid_t _writer = 0;
+  std::vector<std::string> _parts;
+
+};
+
+}
+
+#endif
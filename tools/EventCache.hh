@@ -0,0 +1,502 @@
+// -*- C++ -*-
+#ifndef RIVET_EVENTCACHE_HH
+#define RIVET_EVENTCACHE_HH
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace Rivet {
+
+/// @brief Columnar binary cache of generated events.
+///
+/// Written by hepmcToCache from HepMC files and read back by rivetCache,
+/// so that repeated analysis passes over the same sample skip the text
+/// parsing. The file starts with a header holding the weight names,
+/// followed by blocks of events. Each block stores its columns one after
+/// the other, every column padded to 8 bytes:
+///
+///   per event:    nParticles, flags, event number, impact parameter,
+///                 event-plane angle, Ncoll, Npart (projectile, target),
+///                 cross section and error, the two beams (pid, pz, E)
+///                 and the event weights;
+///   per particle: pt, eta, phi, m (float), pid, status and the index of
+///                 the parent within the event (-1 for none).
+///
+/// Particles along the beam axis (pt = 0), for which eta is not defined,
+/// are stored with phi = NaN and pz in the eta column. A block is stored
+/// raw, in which case the reader uses the mapped file directly, or zlib
+/// compressed, in which case it is inflated into one buffer per block.
+/// Parents always precede their children within an event. The format is
+/// little-endian, like the machines it is used on.
+struct EventCacheFormat {
+
+  static const uint32_t VERSION = 1;
+
+  enum Codec : uint32_t { RAW = 0, ZLIB = 1 };
+
+  enum Flags : int32_t { HEAVYION = 1, CROSSSECTION = 2 };
+
+  struct BlockHeader {
+    uint32_t nEvents;
+    uint32_t nParticles;
+    uint32_t codec;
+    uint32_t pad;
+    uint64_t rawSize;
+    uint64_t storedSize;
+  };
+
+  /// Size of @a n bytes padded to 8.
+  static size_t padded(size_t n) { return (n + 7) & ~size_t(7); }
+
+  /// Raw size of a block of @a nEvents events, @a nParticles particles
+  /// and @a nWeights weights per event.
+  static size_t rawSize(size_t nEvents, size_t nParticles, size_t nWeights) {
+    const size_t e = nEvents, p = nParticles;
+    return 6*padded(e*sizeof(int32_t)) + padded(2*e*sizeof(int32_t))
+      + (4*e + 4*e + e*nWeights)*sizeof(double)
+      + 4*padded(p*sizeof(float)) + 3*padded(p*sizeof(int32_t));
+  }
+
+};
+
+
+/// @brief Writes events into an event cache, one block at a time.
+class EventCacheWriter {
+
+public:
+
+  /// Open @a path for writing, with @a weightNames for every event. Blocks
+  /// are flushed after @a blockParticles particles and compressed with zlib
+  /// level @a level, or stored raw for level 0.
+  EventCacheWriter(const std::string& path, const std::vector<std::string>& weightNames,
+                   int level = 1, size_t blockParticles = 1 << 20)
+    : _out(path, std::ios::binary), _path(path), _weightNames(weightNames),
+      _level(level), _blockParticles(blockParticles) {
+    if(!_out) throw std::runtime_error("EventCache: cannot write " + path);
+    const uint32_t version = EventCacheFormat::VERSION, n = weightNames.size();
+    _out.write("RHICEVTC", 8);
+    _out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    _out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    for(const std::string& name : weightNames)
+    {
+        const uint32_t len = name.size();
+        _out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+        _out.write(name.data(), len);
+    }
+    pad();
+  }
+
+  ~EventCacheWriter() {
+    try { close(); }
+    catch(...) { }
+  }
+
+  EventCacheWriter(const EventCacheWriter&) = delete;
+  EventCacheWriter& operator=(const EventCacheWriter&) = delete;
+
+  /// Start a new event with the given header values. @a weights must hold
+  /// one entry per weight name.
+  void beginEvent(int32_t number, const std::vector<double>& weights) {
+    if(weights.size() != _weightNames.size())
+      throw std::runtime_error("EventCache: event " + std::to_string(number) + " has " +
+                               std::to_string(weights.size()) + " weights, expected " +
+                               std::to_string(_weightNames.size()));
+    _nPart.push_back(0);
+    _flags.push_back(0);
+    _number.push_back(number);
+    _b.push_back(0.);
+    _psi.push_back(0.);
+    _ncoll.push_back(0);
+    _npartProj.push_back(0);
+    _npartTarg.push_back(0);
+    _xs.push_back(0.);
+    _xsErr.push_back(0.);
+    for(int i = 0; i < 2; i++)
+    {
+        _beamPid.push_back(0);
+        _beamPz.push_back(0.);
+        _beamE.push_back(0.);
+    }
+    _weights.insert(_weights.end(), weights.begin(), weights.end());
+  }
+
+  void setHeavyIon(double b, double psi, int ncoll, int npartProj, int npartTarg) {
+    _flags.back() |= EventCacheFormat::HEAVYION;
+    _b.back() = b;
+    _psi.back() = psi;
+    _ncoll.back() = ncoll;
+    _npartProj.back() = npartProj;
+    _npartTarg.back() = npartTarg;
+  }
+
+  void setCrossSection(double xs, double err) {
+    _flags.back() |= EventCacheFormat::CROSSSECTION;
+    _xs.back() = xs;
+    _xsErr.back() = err;
+  }
+
+  /// Beam @a i (0 or 1) along z.
+  void setBeam(int i, int32_t pid, double pz, double E) {
+    const size_t k = 2*(_number.size() - 1) + i;
+    _beamPid[k] = pid;
+    _beamPz[k] = pz;
+    _beamE[k] = E;
+  }
+
+  /// Add a particle to the current event; @a parent is the index of an
+  /// earlier particle of the event, or -1.
+  void addParticle(double px, double py, double pz, double m, int32_t pid, int32_t status, int32_t parent) {
+    const double pt = std::sqrt(px*px + py*py);
+    _pt.push_back(pt);
+    if(pt > 0.)
+    {
+        _eta.push_back(std::asinh(pz/pt));
+        _phi.push_back(std::atan2(py, px));
+    }
+    else
+    {
+        _eta.push_back(pz);
+        _phi.push_back(NAN);
+    }
+    _m.push_back(m);
+    _pid.push_back(pid);
+    _status.push_back(status);
+    _parent.push_back(parent);
+    _nPart.back()++;
+  }
+
+  /// Close the current event, flushing the block if it is full.
+  void endEvent() {
+    _nEvents++;
+    if(_pt.size() >= _blockParticles) flush();
+  }
+
+  /// Write the buffered events as one block.
+  void flush() {
+    const size_t ne = _number.size(), np = _pt.size();
+    if(ne == 0) return;
+    std::vector<char> raw;
+    raw.reserve(EventCacheFormat::rawSize(ne, np, _weightNames.size()));
+    column(raw, _nPart);
+    column(raw, _flags);
+    column(raw, _number);
+    column(raw, _ncoll);
+    column(raw, _npartProj);
+    column(raw, _npartTarg);
+    column(raw, _beamPid);
+    column(raw, _b);
+    column(raw, _psi);
+    column(raw, _xs);
+    column(raw, _xsErr);
+    column(raw, _beamPz);
+    column(raw, _beamE);
+    column(raw, _weights);
+    column(raw, _pt);
+    column(raw, _eta);
+    column(raw, _phi);
+    column(raw, _m);
+    column(raw, _pid);
+    column(raw, _status);
+    column(raw, _parent);
+
+    EventCacheFormat::BlockHeader h;
+    h.nEvents = ne;
+    h.nParticles = np;
+    h.pad = 0;
+    h.rawSize = raw.size();
+    std::vector<char> stored;
+    if(_level > 0)
+    {
+        uLongf len = compressBound(raw.size());
+        stored.resize(len);
+        if(compress2(reinterpret_cast<Bytef*>(stored.data()), &len,
+                     reinterpret_cast<const Bytef*>(raw.data()), raw.size(), _level) != Z_OK)
+          throw std::runtime_error("EventCache: compression failed for " + _path);
+        stored.resize(len);
+        h.codec = EventCacheFormat::ZLIB;
+    }
+    else
+    {
+        stored.swap(raw);
+        h.codec = EventCacheFormat::RAW;
+    }
+    h.storedSize = stored.size();
+    _out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    _out.write(stored.data(), stored.size());
+    pad();
+    if(!_out) throw std::runtime_error("EventCache: cannot write " + _path);
+
+    _nPart.clear(); _flags.clear(); _number.clear();
+    _ncoll.clear(); _npartProj.clear(); _npartTarg.clear(); _beamPid.clear();
+    _b.clear(); _psi.clear(); _xs.clear(); _xsErr.clear(); _beamPz.clear(); _beamE.clear();
+    _weights.clear();
+    _pt.clear(); _eta.clear(); _phi.clear(); _m.clear();
+    _pid.clear(); _status.clear(); _parent.clear();
+  }
+
+  void close() {
+    if(!_out.is_open()) return;
+    flush();
+    _out.close();
+  }
+
+  /// Number of events written so far.
+  size_t numEvents() const { return _nEvents; }
+
+private:
+
+  template <typename T>
+  static void column(std::vector<char>& raw, const std::vector<T>& v) {
+    const char* p = reinterpret_cast<const char*>(v.data());
+    raw.insert(raw.end(), p, p + v.size()*sizeof(T));
+    raw.resize(EventCacheFormat::padded(raw.size()), 0);
+  }
+
+  void pad() {
+    static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    const size_t pos = _out.tellp();
+    _out.write(zeros, EventCacheFormat::padded(pos) - pos);
+  }
+
+  std::ofstream _out;
+  std::string _path;
+  std::vector<std::string> _weightNames;
+  int _level;
+  size_t _blockParticles;
+  size_t _nEvents = 0;
+
+  std::vector<int32_t> _nPart, _flags, _number, _ncoll, _npartProj, _npartTarg, _beamPid;
+  std::vector<double> _b, _psi, _xs, _xsErr, _beamPz, _beamE, _weights;
+  std::vector<float> _pt, _eta, _phi, _m;
+  std::vector<int32_t> _pid, _status, _parent;
+
+};
+
+
+/// @brief Reads an event cache through a read-only mapping of the file.
+///
+///   EventCacheReader cache("sample.evc");
+///   EventCacheReader::Event ev;
+///   while(cache.next(ev)) { for(size_t i = 0; i < ev.size(); i++) ... ev.pt(i) ... }
+class EventCacheReader {
+
+public:
+
+  /// One event: views into the columns of its block, valid until the next
+  /// call of next().
+  class Event {
+  public:
+    size_t size() const { return _n; }
+    int32_t number() const { return _r->_number[_e]; }
+    bool hasHeavyIon() const { return _r->_flags[_e] & EventCacheFormat::HEAVYION; }
+    bool hasCrossSection() const { return _r->_flags[_e] & EventCacheFormat::CROSSSECTION; }
+    double impactParameter() const { return _r->_b[_e]; }
+    double eventPlaneAngle() const { return _r->_psi[_e]; }
+    int ncoll() const { return _r->_ncoll[_e]; }
+    int npartProj() const { return _r->_npartProj[_e]; }
+    int npartTarg() const { return _r->_npartTarg[_e]; }
+    double crossSection() const { return _r->_xs[_e]; }
+    double crossSectionError() const { return _r->_xsErr[_e]; }
+    int32_t beamPid(int i) const { return _r->_beamPid[2*_e + i]; }
+    double beamPz(int i) const { return _r->_beamPz[2*_e + i]; }
+    double beamE(int i) const { return _r->_beamE[2*_e + i]; }
+    const double* weights() const { return _r->_weights + _e*_r->_weightNames.size(); }
+    size_t numWeights() const { return _r->_weightNames.size(); }
+
+    float pt(size_t i) const { return _r->_pt[_first + i]; }
+    float eta(size_t i) const { return _r->_eta[_first + i]; }
+    float phi(size_t i) const { return _r->_phi[_first + i]; }
+    float m(size_t i) const { return _r->_m[_first + i]; }
+    int32_t pid(size_t i) const { return _r->_pid[_first + i]; }
+    int32_t status(size_t i) const { return _r->_status[_first + i]; }
+    int32_t parent(size_t i) const { return _r->_parent[_first + i]; }
+
+    /// Cartesian momentum of particle @a i.
+    void momentum(size_t i, double& px, double& py, double& pz, double& E) const {
+      const double pT = pt(i), M = m(i);
+      if(std::isnan(phi(i)))
+      {
+          px = py = 0.;
+          pz = eta(i);
+      }
+      else
+      {
+          px = pT*std::cos(phi(i));
+          py = pT*std::sin(phi(i));
+          pz = pT*std::sinh(eta(i));
+      }
+      // A negative mass stands for a slightly negative m^2, as in HepMC
+      E = std::sqrt(std::max(0., px*px + py*py + pz*pz + (M < 0. ? -M*M : M*M)));
+    }
+
+  private:
+    friend class EventCacheReader;
+    const EventCacheReader* _r = nullptr;
+    size_t _e = 0, _first = 0, _n = 0;
+  };
+
+  explicit EventCacheReader(const std::string& path) : _path(path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0) throw std::runtime_error("EventCache: cannot open " + path);
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size < 16)
+    {
+        ::close(fd);
+        throw std::runtime_error("EventCache: " + path + " is not an event cache");
+    }
+    _size = st.st_size;
+    _map = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(_map == MAP_FAILED)
+    {
+        _map = nullptr;
+        throw std::runtime_error("EventCache: cannot map " + path);
+    }
+    madvise(_map, _size, MADV_SEQUENTIAL);
+
+    const char* p = static_cast<const char*>(_map);
+    uint32_t version = 0, n = 0;
+    std::memcpy(&version, p + 8, sizeof(version));
+    std::memcpy(&n, p + 12, sizeof(n));
+    if(std::memcmp(p, "RHICEVTC", 8) != 0 || version != EventCacheFormat::VERSION)
+    {
+        unmap();
+        throw std::runtime_error("EventCache: " + path + " has a wrong format or version");
+    }
+    size_t pos = 16;
+    for(uint32_t i = 0; i < n; i++)
+    {
+        uint32_t len = 0;
+        if(pos + sizeof(len) > _size) truncated();
+        std::memcpy(&len, p + pos, sizeof(len));
+        pos += sizeof(len);
+        if(pos + len > _size) truncated();
+        _weightNames.emplace_back(p + pos, len);
+        pos += len;
+    }
+    _pos = EventCacheFormat::padded(pos);
+  }
+
+  ~EventCacheReader() { unmap(); }
+
+  EventCacheReader(const EventCacheReader&) = delete;
+  EventCacheReader& operator=(const EventCacheReader&) = delete;
+
+  const std::vector<std::string>& weightNames() const { return _weightNames; }
+
+  /// Point @a ev to the next event; false at the end of the file.
+  bool next(Event& ev) {
+    while(_event >= _nEvents)
+    {
+        if(!readBlock()) return false;
+    }
+    ev._r = this;
+    ev._e = _event;
+    ev._first = _first;
+    ev._n = _nPart[_event];
+    _first += ev._n;
+    _event++;
+    return true;
+  }
+
+private:
+
+  [[noreturn]] void truncated() const {
+    throw std::runtime_error("EventCache: " + _path + " is truncated");
+  }
+
+  /// Set up the column views of the next block.
+  bool readBlock() {
+    if(_pos + sizeof(EventCacheFormat::BlockHeader) > _size) return false;
+    const char* base = static_cast<const char*>(_map);
+    EventCacheFormat::BlockHeader h;
+    std::memcpy(&h, base + _pos, sizeof(h));
+    const char* stored = base + _pos + sizeof(h);
+    if(_pos + sizeof(h) + h.storedSize > _size) truncated();
+    _pos = EventCacheFormat::padded(_pos + sizeof(h) + h.storedSize);
+
+    const char* raw = stored;
+    if(h.codec == EventCacheFormat::ZLIB)
+    {
+        _buffer.resize(h.rawSize/sizeof(double) + 1);
+        uLongf len = h.rawSize;
+        if(uncompress(reinterpret_cast<Bytef*>(_buffer.data()), &len,
+                      reinterpret_cast<const Bytef*>(stored), h.storedSize) != Z_OK || len != h.rawSize)
+          throw std::runtime_error("EventCache: corrupt block in " + _path);
+        raw = reinterpret_cast<const char*>(_buffer.data());
+    }
+    else if(h.codec != EventCacheFormat::RAW || h.storedSize != h.rawSize)
+      throw std::runtime_error("EventCache: unknown block codec in " + _path);
+
+    const size_t ne = h.nEvents, np = h.nParticles;
+    size_t off = 0;
+    _nPart = column<int32_t>(raw, off, ne);
+    _flags = column<int32_t>(raw, off, ne);
+    _number = column<int32_t>(raw, off, ne);
+    _ncoll = column<int32_t>(raw, off, ne);
+    _npartProj = column<int32_t>(raw, off, ne);
+    _npartTarg = column<int32_t>(raw, off, ne);
+    _beamPid = column<int32_t>(raw, off, 2*ne);
+    _b = column<double>(raw, off, ne);
+    _psi = column<double>(raw, off, ne);
+    _xs = column<double>(raw, off, ne);
+    _xsErr = column<double>(raw, off, ne);
+    _beamPz = column<double>(raw, off, 2*ne);
+    _beamE = column<double>(raw, off, 2*ne);
+    _weights = column<double>(raw, off, ne*_weightNames.size());
+    _pt = column<float>(raw, off, np);
+    _eta = column<float>(raw, off, np);
+    _phi = column<float>(raw, off, np);
+    _m = column<float>(raw, off, np);
+    _pid = column<int32_t>(raw, off, np);
+    _status = column<int32_t>(raw, off, np);
+    _parent = column<int32_t>(raw, off, np);
+    if(off != h.rawSize) throw std::runtime_error("EventCache: corrupt block in " + _path);
+
+    _nEvents = ne;
+    _event = _first = 0;
+    return true;
+  }
+
+  template <typename T>
+  static const T* column(const char* raw, size_t& off, size_t n) {
+    const T* p = reinterpret_cast<const T*>(raw + off);
+    off += EventCacheFormat::padded(n*sizeof(T));
+    return p;
+  }
+
+  void unmap() {
+    if(_map) munmap(_map, _size);
+    _map = nullptr;
+  }
+
+  std::string _path;
+  void* _map = nullptr;
+  size_t _size = 0, _pos = 0;
+  std::vector<std::string> _weightNames;
+  std::vector<double> _buffer;
+
+  size_t _nEvents = 0, _event = 0, _first = 0;
+  const int32_t *_nPart = nullptr, *_flags = nullptr, *_number = nullptr;
+  const int32_t *_ncoll = nullptr, *_npartProj = nullptr, *_npartTarg = nullptr, *_beamPid = nullptr;
+  const double *_b = nullptr, *_psi = nullptr, *_xs = nullptr, *_xsErr = nullptr;
+  const double *_beamPz = nullptr, *_beamE = nullptr, *_weights = nullptr;
+  const float *_pt = nullptr, *_eta = nullptr, *_phi = nullptr, *_m = nullptr;
+  const int32_t *_pid = nullptr, *_status = nullptr, *_parent = nullptr;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,254 @@
+// -*- C++ -*-
+#ifndef RIVET_HEPMCINDEX_HH
+#define RIVET_HEPMCINDEX_HH
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Rivet {
+
+/// @brief Input stream over a list of byte ranges, read in turn.
+///
+/// Used to present the header of a HepMC file followed by a range of its
+/// events to a HepMC reader as one stream, without copying the bytes.
+class SegmentStream : public std::istream {
+
+public:
+
+  typedef std::vector<std::pair<const char*, const char*> > Segments;
+
+  explicit SegmentStream(const Segments& segments)
+    : std::istream(nullptr), _buf(segments) {
+    rdbuf(&_buf);
+  }
+
+private:
+
+  class Buffer : public std::streambuf {
+  public:
+    explicit Buffer(const Segments& segments) : _segments(segments) { }
+  protected:
+    int_type underflow() {
+      while(gptr() == egptr())
+      {
+          if(_next == _segments.size()) return traits_type::eof();
+          char* begin = const_cast<char*>(_segments[_next].first);
+          char* end = const_cast<char*>(_segments[_next].second);
+          setg(begin, begin, end);
+          _next++;
+      }
+      return traits_type::to_int_type(*gptr());
+    }
+  private:
+    Segments _segments;
+    size_t _next = 0;
+  };
+
+  Buffer _buf;
+
+};
+
+
+/// @brief Byte offsets of the events of a HepMC ASCII file.
+///
+/// A file is scanned once for the lines that open an event ("E ..." in
+/// both HepMC2 IO_GenEvent and HepMC3 Asciiv3) and for the listing markers
+/// ("HepMC::..."). The index is saved next to the file as FILE.idx and
+/// reused as long as the size and modification time of the file match,
+/// so a sample archive only pays the scan once. With the index, events
+/// [first, last) can be read by mapping the file and handing the header
+/// and the byte range of those events to a reader (see stream()), which is
+/// how rivetShard splits one file over several processes.
+///
+/// Only uncompressed files can be indexed.
+class HepMCIndex {
+
+public:
+
+  static const uint32_t VERSION = 1;
+
+  /// Index of @a path, loaded from @a path.idx if it is up to date, else
+  /// built by scanning the file and, if @a save, written there.
+  explicit HepMCIndex(const std::string& path, bool save = true) : _path(path) {
+    struct stat st;
+    if(stat(path.c_str(), &st) != 0) throw std::runtime_error("HepMCIndex: cannot open " + path);
+    _fileSize = st.st_size;
+    _mtime = st.st_mtime;
+    if(load()) return;
+    scan();
+    if(save) write();
+  }
+
+  ~HepMCIndex() { unmap(); }
+
+  HepMCIndex(const HepMCIndex&) = delete;
+  HepMCIndex& operator=(const HepMCIndex&) = delete;
+
+  static std::string indexPath(const std::string& path) { return path + ".idx"; }
+
+  const std::string& path() const { return _path; }
+
+  /// HepMC version of the file, 2 or 3.
+  int format() const { return _format; }
+
+  size_t size() const { return _begin.size(); }
+
+  /// Bytes before the first event: version line, listing start and, for
+  /// HepMC3, the run information.
+  uint64_t headerSize() const { return _header; }
+
+  /// Byte range of event @a i.
+  uint64_t begin(size_t i) const { return _begin[i]; }
+  uint64_t end(size_t i) const { return _end[i]; }
+
+  /// Stream of the header followed by events [@a first, @a last) and the
+  /// end-of-listing line. The file stays mapped for the lifetime of the
+  /// index.
+  std::unique_ptr<SegmentStream> stream(size_t first, size_t last) {
+    map();
+    const char* p = static_cast<const char*>(_map);
+    SegmentStream::Segments segments;
+    segments.push_back(std::make_pair(p, p + _header));
+    for(size_t i = first; i < last && i < size(); i++)
+    {
+        // Adjacent events make one range
+        if(segments.size() > 1 && segments.back().second == p + _begin[i]) segments.back().second = p + _end[i];
+        else segments.push_back(std::make_pair(p + _begin[i], p + _end[i]));
+    }
+    // The readers peek past an event for the next line, and one that hits
+    // the end of the stream counts as failed, so the last event needs the
+    // footer after it
+    const char* footer = _format == 3 ? "HepMC::Asciiv3-END_EVENT_LISTING\n" : "HepMC::IO_GenEvent-END_EVENT_LISTING\n";
+    segments.push_back(std::make_pair(footer, footer + std::strlen(footer)));
+    return std::unique_ptr<SegmentStream>(new SegmentStream(segments));
+  }
+
+private:
+
+  bool load() {
+    std::ifstream in(indexPath(_path), std::ios::binary);
+    if(!in) return false;
+    char magic[8];
+    uint32_t version = 0, format = 0;
+    uint64_t fileSize = 0, header = 0, n = 0;
+    int64_t mtime = 0;
+    in.read(magic, 8);
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&format), sizeof(format));
+    in.read(reinterpret_cast<char*>(&fileSize), sizeof(fileSize));
+    in.read(reinterpret_cast<char*>(&mtime), sizeof(mtime));
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if(!in || std::memcmp(magic, "RHICHMIX", 8) != 0 || version != VERSION ||
+       fileSize != _fileSize || mtime != _mtime) return false;
+    _begin.resize(n);
+    _end.resize(n);
+    in.read(reinterpret_cast<char*>(_begin.data()), n*sizeof(uint64_t));
+    in.read(reinterpret_cast<char*>(_end.data()), n*sizeof(uint64_t));
+    if(!in)
+    {
+        _begin.clear();
+        _end.clear();
+        return false;
+    }
+    _format = format;
+    _header = header;
+    return true;
+  }
+
+  void write() const {
+    // An index that cannot be written (read-only archive) is rebuilt next time
+    std::ofstream out(indexPath(_path), std::ios::binary);
+    if(!out) return;
+    const uint32_t version = VERSION, format = _format;
+    const uint64_t n = size();
+    out.write("RHICHMIX", 8);
+    out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    out.write(reinterpret_cast<const char*>(&format), sizeof(format));
+    out.write(reinterpret_cast<const char*>(&_fileSize), sizeof(_fileSize));
+    out.write(reinterpret_cast<const char*>(&_mtime), sizeof(_mtime));
+    out.write(reinterpret_cast<const char*>(&_header), sizeof(_header));
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char*>(_begin.data()), n*sizeof(uint64_t));
+    out.write(reinterpret_cast<const char*>(_end.data()), n*sizeof(uint64_t));
+  }
+
+  /// One pass over the lines of the file. An event runs from its "E" line
+  /// to the next "E" line or listing marker, so that the markers of
+  /// concatenated files stay out of the event ranges.
+  void scan() {
+    map();
+    madvise(_map, _fileSize, MADV_SEQUENTIAL);
+    const char* data = static_cast<const char*>(_map);
+    const char* end = data + _fileSize;
+    bool inEvent = false;
+    for(const char* p = data; p < end; )
+    {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        const char* next = nl ? nl + 1 : end;
+        const size_t len = next - p;
+        if(len >= 2 && p[0] == 'E' && p[1] == ' ')
+        {
+            if(inEvent) _end.push_back(p - data);
+            _begin.push_back(p - data);
+            inEvent = true;
+        }
+        else if(len >= 7 && std::memcmp(p, "HepMC::", 7) == 0)
+        {
+            if(inEvent) _end.push_back(p - data);
+            inEvent = false;
+            const std::string line(p, len);
+            if(_format == 0 && line.find("IO_GenEvent") != std::string::npos) _format = 2;
+            else if(_format == 0 && line.find("Asciiv3") != std::string::npos) _format = 3;
+        }
+        p = next;
+    }
+    if(inEvent) _end.push_back(_fileSize);
+    if(_format == 0)
+      throw std::runtime_error("HepMCIndex: " + _path + " is not an uncompressed HepMC2/3 ASCII file");
+    _header = _begin.empty() ? _fileSize : _begin.front();
+  }
+
+  void map() {
+    if(_map) return;
+    const int fd = ::open(_path.c_str(), O_RDONLY);
+    if(fd < 0) throw std::runtime_error("HepMCIndex: cannot open " + _path);
+    _map = _fileSize ? mmap(nullptr, _fileSize, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+    ::close(fd);
+    if(_map == MAP_FAILED)
+    {
+        _map = nullptr;
+        throw std::runtime_error("HepMCIndex: cannot map " + _path);
+    }
+  }
+
+  void unmap() {
+    if(_map) munmap(_map, _fileSize);
+    _map = nullptr;
+  }
+
+  std::string _path;
+  uint64_t _fileSize = 0;
+  int64_t _mtime = 0;
+  uint64_t _header = 0;
+  int _format = 0;
+  std::vector<uint64_t> _begin, _end;
+  void* _map = nullptr;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+// Print MC-Glauber <N_coll>, <N_part> and <b> per centrality class for the
+// collision systems of the calibrations in ../Centralities/Calibration.
+//
+// Compile (only needs the header in ../Centralities):
+//   g++ -O2 -std=c++14 -o glauberTables glauberTables.cc
+//
+// Usage:
+//   glauberTables [-n events] [-e 0,5,10,20,...] [SYSTEM:SQRTS ...]
+// e.g.
+//   glauberTables AuAu:200 dAu:200 CuAu:200
+// Without systems, all RHIC systems with a calibration are tabulated.
+// Set RIVET_GLAUBER_CACHE to a directory to reuse the generated events in
+// later runs and in the analyses.
+
+#include "../Centralities/Glauber.hh"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+using namespace Rivet;
+
+int main(int argc, char** argv) {
+  size_t nEvents = 50000;
+  std::vector<double> edges = {0., 5., 10., 20., 30., 40., 50., 60., 70., 80., 92.};
+  std::vector<std::string> systems;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-n" && i + 1 < argc) nEvents = std::atol(argv[++i]);
+      else if(arg == "-e" && i + 1 < argc)
+      {
+          edges.clear();
+          std::stringstream ss(argv[++i]);
+          std::string item;
+          while(std::getline(ss, item, ',')) edges.push_back(std::atof(item.c_str()));
+      }
+      else systems.push_back(arg);
+  }
+  if(systems.empty())
+    systems = {"AuAu:200", "AuAu:130", "AuAu:62.4", "AuAu:39", "CuCu:200", "CuAu:200", "dAu:200"};
+
+  for(const std::string& s : systems)
+  {
+      const size_t colon = s.find(':');
+      if(colon == std::string::npos)
+      {
+          std::cerr << "Expected SYSTEM:SQRTS, got " << s << std::endl;
+          return 1;
+      }
+      const std::string sys = s.substr(0, colon);
+      const double sqrts = std::atof(s.c_str() + colon + 1);
+      const double sigma = Glauber::sigmaNN(sqrts);
+      try
+      {
+          const Glauber& g = Glauber::get(sys, sigma, nEvents);
+          printf("# %s sqrt(s_NN) = %g GeV, sigma_NN = %.1f mb, %zu events\n", sys.c_str(), sqrts, sigma, g.numEvents());
+          printf("# cent       <Ncoll>   <Npart>   <b>/fm\n");
+          for(size_t i = 0; i + 1 < edges.size(); i++)
+          {
+              printf("%5g-%-5g %9.1f %9.1f %8.2f\n", edges[i], edges[i + 1],
+                     g.ncoll(edges[i], edges[i + 1]), g.npart(edges[i], edges[i + 1]), g.b(edges[i], edges[i + 1]));
+          }
+      }
+      catch(const std::exception& e)
+      {
+          std::cerr << e.what() << std::endl;
+          return 1;
+      }
+  }
+  return 0;
+}
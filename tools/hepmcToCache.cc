@@ -0,0 +1,157 @@
+// Convert HepMC event files into a columnar event cache (EventCache.hh),
+// which rivetCache runs the analyses on without parsing the text again.
+//
+// Compile (needs HepMC3 and zlib):
+//   g++ -O2 -std=c++14 -o hepmcToCache hepmcToCache.cc $(HepMC3-config --cflags --libs) -lz
+//
+// Usage:
+//   hepmcToCache [-s 1,2] [-z level] [-n events] -o sample.evc file1.hepmc file2.hepmc ...
+//
+// Kept are the particles with one of the statuses given with -s: by default
+// the final state (1) and the decayed hadrons (2), so that decay chains,
+// feed-down and unstable-particle projections work on the cache. Add 3 for
+// the JEWEL scattering centres. The parent of a kept particle is its
+// nearest kept ancestor along the first incoming particle of each vertex.
+// -z sets the zlib level of the blocks; 0 stores them raw, which the
+// reader uses straight from the mapped file.
+
+#include "EventCache.hh"
+#include "HepMC3/GenEvent.h"
+#include "HepMC3/GenHeavyIon.h"
+#include "HepMC3/GenCrossSection.h"
+#include "HepMC3/GenParticle.h"
+#include "HepMC3/GenVertex.h"
+#include "HepMC3/ReaderFactory.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <sstream>
+
+using namespace Rivet;
+
+int main(int argc, char** argv) {
+  std::string output;
+  std::set<int> statuses = {1, 2};
+  int level = 1;
+  long maxEvents = -1;
+  std::vector<std::string> inputs;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-o" && i + 1 < argc) output = argv[++i];
+      else if(arg == "-z" && i + 1 < argc) level = std::atoi(argv[++i]);
+      else if(arg == "-n" && i + 1 < argc) maxEvents = std::atol(argv[++i]);
+      else if(arg == "-s" && i + 1 < argc)
+      {
+          statuses.clear();
+          std::stringstream ss(argv[++i]);
+          std::string item;
+          while(std::getline(ss, item, ',')) statuses.insert(std::atoi(item.c_str()));
+      }
+      else inputs.push_back(arg);
+  }
+  if(output.empty() || inputs.empty())
+  {
+      std::cerr << "Usage: " << argv[0] << " [-s 1,2] [-z level] [-n events] -o sample.evc file1.hepmc ..." << std::endl;
+      return 1;
+  }
+
+  try
+  {
+      std::unique_ptr<EventCacheWriter> cache;
+      std::vector<std::string> weightNames;
+      long nEvents = 0;
+      for(const std::string& in : inputs)
+      {
+          std::shared_ptr<HepMC3::Reader> reader = HepMC3::deduce_reader(in);
+          if(!reader) throw std::runtime_error("hepmcToCache: cannot read " + in);
+          HepMC3::GenEvent ge;
+          while((maxEvents < 0 || nEvents < maxEvents) && reader->read_event(ge) && !reader->failed())
+          {
+              ge.set_units(HepMC3::Units::GEV, HepMC3::Units::MM);
+              if(!cache)
+              {
+                  if(ge.run_info()) weightNames = ge.run_info()->weight_names();
+                  if(weightNames.size() != ge.weights().size())
+                  {
+                      weightNames.clear();
+                      for(size_t i = 0; i < ge.weights().size(); i++)
+                        weightNames.push_back(i == 0 ? "" : "WEIGHT_" + std::to_string(i));
+                  }
+                  cache.reset(new EventCacheWriter(output, weightNames, level));
+              }
+
+              cache->beginEvent(ge.event_number(), ge.weights());
+              if(ge.heavy_ion())
+              {
+                  const HepMC3::GenHeavyIon& hi = *ge.heavy_ion();
+                  cache->setHeavyIon(hi.impact_parameter, hi.event_plane_angle, hi.Ncoll, hi.Npart_proj, hi.Npart_targ);
+              }
+              if(ge.cross_section())
+                cache->setCrossSection(ge.cross_section()->xsec(), ge.cross_section()->xsec_err());
+              std::vector<HepMC3::ConstGenParticlePtr> beams = ge.beams();
+              for(size_t i = 0; i < std::min<size_t>(2, beams.size()); i++)
+                cache->setBeam(i, beams[i]->pdg_id(), beams[i]->momentum().pz(), beams[i]->momentum().e());
+
+              // Kept particles and their nearest kept ancestor, by HepMC id
+              const std::vector<HepMC3::ConstGenParticlePtr>& particles = ge.particles();
+              std::vector<int> slot(particles.size(), -1);
+              std::vector<HepMC3::ConstGenParticlePtr> kept;
+              for(const HepMC3::ConstGenParticlePtr& p : particles)
+              {
+                  if(!statuses.count(p->status())) continue;
+                  slot[p->id() - 1] = kept.size();
+                  kept.push_back(p);
+              }
+              std::vector<int> parent(kept.size(), -1), depth(kept.size(), 0);
+              for(size_t k = 0; k < kept.size(); k++)
+              {
+                  HepMC3::ConstGenVertexPtr v = kept[k]->production_vertex();
+                  for(int steps = 0; v && !v->particles_in().empty() && steps < 10000; steps++)
+                  {
+                      const HepMC3::ConstGenParticlePtr& q = v->particles_in().front();
+                      if(slot[q->id() - 1] >= 0)
+                      {
+                          parent[k] = slot[q->id() - 1];
+                          break;
+                      }
+                      v = q->production_vertex();
+                  }
+              }
+              // Parents before children: order by the depth in the kept tree
+              for(size_t k = 0; k < kept.size(); k++)
+              {
+                  int d = 0;
+                  for(int j = parent[k]; j >= 0 && d <= int(kept.size()); j = parent[j]) d++;
+                  depth[k] = d;
+              }
+              std::vector<size_t> order(kept.size());
+              for(size_t k = 0; k < kept.size(); k++) order[k] = k;
+              std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return depth[a] < depth[b]; });
+              std::vector<int> position(kept.size());
+              for(size_t i = 0; i < order.size(); i++) position[order[i]] = i;
+
+              for(size_t k : order)
+              {
+                  const HepMC3::FourVector& mom = kept[k]->momentum();
+                  cache->addParticle(mom.px(), mom.py(), mom.pz(), mom.m(), kept[k]->pdg_id(),
+                                     kept[k]->status(), parent[k] >= 0 ? position[parent[k]] : -1);
+              }
+              cache->endEvent();
+              nEvents++;
+          }
+          reader->close();
+      }
+      if(!cache) throw std::runtime_error("hepmcToCache: no events read");
+      cache->close();
+      std::cout << "Wrote " << nEvents << " events to " << output << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,73 @@
+// Merge the centrality sketches written by RHIC_2019_CentralityCalibration
+// (option sketch=FILE) from many parallel jobs, and print the centrality
+// class edges of the merged estimator and impact-parameter distributions.
+//
+// Compile (only needs the header in ../Centralities):
+//   g++ -O2 -std=c++14 -o mergeCentralitySketch mergeCentralitySketch.cc
+//
+// Usage:
+//   mergeCentralitySketch [-o merged.sketch] [-e 5,10,20,...] job1.sketch job2.sketch ...
+//
+// The estimator (CMULT) edges are upper percentiles, 0-5% being the 5%
+// of events with the largest estimator; the impact-parameter (CMULT_IMP)
+// edges are lower percentiles, 0-5% being the 5% smallest b.
+
+#include "../Centralities/QuantileSketch.hh"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+using namespace Rivet;
+
+int main(int argc, char** argv) {
+  std::string output;
+  std::vector<double> edges = {5., 10., 20., 30., 40., 50., 60., 70., 80., 90.};
+  std::vector<std::string> inputs;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-o" && i + 1 < argc) output = argv[++i];
+      else if(arg == "-e" && i + 1 < argc)
+      {
+          edges.clear();
+          std::stringstream ss(argv[++i]);
+          std::string item;
+          while(std::getline(ss, item, ',')) edges.push_back(std::atof(item.c_str()));
+      }
+      else inputs.push_back(arg);
+  }
+  if(inputs.empty())
+  {
+      std::cerr << "Usage: " << argv[0] << " [-o merged.sketch] [-e 5,10,20,...] job1.sketch ..." << std::endl;
+      return 1;
+  }
+
+  QuantileSketches sketches;
+  try
+  {
+      for(const std::string& in : inputs) mergeSketches(in, sketches);
+      if(!output.empty()) writeSketches(output, sketches);
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      return 1;
+  }
+
+  for(const auto& s : sketches)
+  {
+      // Impact parameter: central = small; estimators: central = large
+      const bool lower = (s.first.size() > 4 && s.first.compare(s.first.size() - 4, 4, "_IMP") == 0);
+      printf("# %s: %zu files, sum of weights %g, %zu centroids\n", s.first.c_str(), inputs.size(),
+             s.second.totalWeight(), s.second.numCentroids());
+      double low = 0.;
+      for(double pct : edges)
+      {
+          const double v = s.second.quantile(lower ? pct/100. : 1. - pct/100.);
+          printf("%s %g-%g%% %s %g\n", s.first.c_str(), low, pct, lower ? "<" : ">=", v);
+          low = pct;
+      }
+  }
+  return 0;
+}
@@ -0,0 +1,152 @@
+// Run Rivet analyses on event caches written by hepmcToCache, instead of
+// parsing the HepMC files again on every pass.
+//
+// Compile (needs Rivet, HepMC3 and zlib):
+//   g++ -O2 -std=c++14 -o rivetCache rivetCache.cc $(rivet-config --cppflags --ldflags --libs) -lz
+//
+// Usage:
+//   rivetCache [--pwd] [--ignore-beams] [-p preload.yoda] [-n events] [-o Rivet.yoda]
+//              -a ANALYSIS[:opt=val...] [-a ...] sample1.evc sample2.evc ...
+// e.g., as in PHENIX_2008_I777211/RunAnalysis.sh,
+//   rivetCache --pwd -p ../Centralities/Calibration/calibration_PHENIX_AuAu200GeV.yoda
+//              -a PHENIX_2008_I777211:cent=GEN:beam=AUAU200 -o Rivet.yoda PYTHIAAuAu.evc
+//
+// Each cached event is rebuilt as a HepMC3 event: the beams enter a root
+// vertex, particles without a kept parent leave it and every other
+// particle leaves the decay vertex of its parent, with the heavy-ion
+// information, cross section and weights of the original event.
+
+#include "EventCache.hh"
+#include "Rivet/AnalysisHandler.hh"
+#include "Rivet/Tools/RivetPaths.hh"
+#include "HepMC3/GenEvent.h"
+#include "HepMC3/GenHeavyIon.h"
+#include "HepMC3/GenCrossSection.h"
+#include "HepMC3/GenParticle.h"
+#include "HepMC3/GenRunInfo.h"
+#include "HepMC3/GenVertex.h"
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <unistd.h>
+
+using namespace Rivet;
+
+/// Rebuild the HepMC3 event of @a ev.
+static void rebuild(const EventCacheReader::Event& ev, const std::shared_ptr<HepMC3::GenRunInfo>& runInfo, HepMC3::GenEvent& ge) {
+  ge.set_run_info(runInfo);
+  ge.set_event_number(ev.number());
+  ge.weights().assign(ev.weights(), ev.weights() + ev.numWeights());
+  if(ev.hasHeavyIon())
+  {
+      std::shared_ptr<HepMC3::GenHeavyIon> hi = std::make_shared<HepMC3::GenHeavyIon>();
+      hi->impact_parameter = ev.impactParameter();
+      hi->event_plane_angle = ev.eventPlaneAngle();
+      hi->Ncoll = ev.ncoll();
+      hi->Npart_proj = ev.npartProj();
+      hi->Npart_targ = ev.npartTarg();
+      ge.set_heavy_ion(hi);
+  }
+  if(ev.hasCrossSection())
+  {
+      std::shared_ptr<HepMC3::GenCrossSection> cs = std::make_shared<HepMC3::GenCrossSection>();
+      ge.set_cross_section(cs);
+      cs->set_cross_section(ev.crossSection(), ev.crossSectionError());
+  }
+
+  HepMC3::GenVertexPtr root = std::make_shared<HepMC3::GenVertex>();
+  for(int i = 0; i < 2; i++)
+  {
+      if(ev.beamPid(i) == 0) continue;
+      root->add_particle_in(std::make_shared<HepMC3::GenParticle>(
+        HepMC3::FourVector(0., 0., ev.beamPz(i), ev.beamE(i)), ev.beamPid(i), 4));
+  }
+  ge.add_vertex(root);
+
+  std::vector<HepMC3::GenParticlePtr> particles(ev.size());
+  std::vector<HepMC3::GenVertexPtr> decays(ev.size());
+  for(size_t i = 0; i < ev.size(); i++)
+  {
+      double px, py, pz, E;
+      ev.momentum(i, px, py, pz, E);
+      particles[i] = std::make_shared<HepMC3::GenParticle>(HepMC3::FourVector(px, py, pz, E), ev.pid(i), ev.status(i));
+      const int j = ev.parent(i);
+      if(j < 0 || j >= int(i))
+      {
+          root->add_particle_out(particles[i]);
+          continue;
+      }
+      if(!decays[j])
+      {
+          decays[j] = std::make_shared<HepMC3::GenVertex>();
+          decays[j]->add_particle_in(particles[j]);
+          ge.add_vertex(decays[j]);
+      }
+      decays[j]->add_particle_out(particles[i]);
+  }
+}
+
+int main(int argc, char** argv) {
+  std::vector<std::string> analyses, preloads, inputs;
+  std::string output = "Rivet.yoda";
+  bool ignoreBeams = false;
+  long maxEvents = -1;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-a" && i + 1 < argc) analyses.push_back(argv[++i]);
+      else if(arg == "-p" && i + 1 < argc) preloads.push_back(argv[++i]);
+      else if(arg == "-o" && i + 1 < argc) output = argv[++i];
+      else if(arg == "-n" && i + 1 < argc) maxEvents = std::atol(argv[++i]);
+      else if(arg == "--ignore-beams") ignoreBeams = true;
+      else if(arg == "--pwd")
+      {
+          char cwd[4096];
+          if(getcwd(cwd, sizeof(cwd)))
+          {
+              addAnalysisLibPath(cwd);
+              addAnalysisDataPath(cwd);
+          }
+      }
+      else inputs.push_back(arg);
+  }
+  if(analyses.empty() || inputs.empty())
+  {
+      std::cerr << "Usage: " << argv[0] << " [--pwd] [--ignore-beams] [-p preload.yoda] [-n events] [-o Rivet.yoda]"
+                << " -a ANALYSIS[:opt=val...] ... sample.evc ..." << std::endl;
+      return 1;
+  }
+
+  try
+  {
+      AnalysisHandler ah;
+      ah.setIgnoreBeams(ignoreBeams);
+      for(const std::string& p : preloads) ah.readData(p);
+      ah.addAnalyses(analyses);
+
+      long nEvents = 0;
+      for(const std::string& in : inputs)
+      {
+          EventCacheReader cache(in);
+          std::shared_ptr<HepMC3::GenRunInfo> runInfo = std::make_shared<HepMC3::GenRunInfo>();
+          runInfo->set_weight_names(cache.weightNames());
+          EventCacheReader::Event ev;
+          while((maxEvents < 0 || nEvents < maxEvents) && cache.next(ev))
+          {
+              HepMC3::GenEvent ge(HepMC3::Units::GEV, HepMC3::Units::MM);
+              rebuild(ev, runInfo, ge);
+              ah.analyze(ge);
+              nEvents++;
+          }
+      }
+      ah.finalize();
+      ah.writeData(output);
+      std::cout << "Analysed " << nEvents << " events, written to " << output << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,283 @@
+// Run Rivet analyses on the events of several generator processes at
+// once, each writing HepMC to its own FIFO (see FIFO/RunFanOut.sh).
+//
+// Compile (needs Rivet and HepMC3):
+//   g++ -O2 -std=c++14 -o rivetFanIn rivetFanIn.cc $(rivet-config --cppflags --ldflags --libs)
+//
+// Usage:
+//   rivetFanIn [--pwd] [--ignore-beams] [-p preload.yoda] [-n events] [-o Rivet.yoda]
+//              [--checkpoint Rivet.ckpt.yoda] [--every events] [--resume]
+//              -a ANALYSIS[:opt=val...] [-a ...] /tmp/fifo1.hepmc /tmp/fifo2.hepmc ...
+//
+// One rivet process per generator loads the plugins and calibrations once
+// per job and waits whenever its generator stalls. Here one process reads
+// all the FIFOs: the bytes of every FIFO are collected as they arrive, and
+// an event is handed to its HepMC reader only once it is complete (the
+// next event or the end of the listing has arrived), taking the FIFOs with
+// complete events in turn. The analyses run in this one thread: Rivet's
+// projection handler is shared by the whole process and the analyses are
+// not thread-safe, so the parallelism is in the generators. If the
+// analyses cannot keep up with the generators, run several of these hosts
+// on separate FIFOs and merge their outputs with rivet-merge -e.
+//
+// With --checkpoint the analysis state is written to that file every
+// --every events (10000 by default) without stopping the event loop
+// (Checkpoint.hh), so a job killed at its wall time leaves a partial
+// result. A job restarted with --resume appends to it: the snapshots of
+// the killed jobs are merged into the final output.
+
+#include "Checkpoint.hh"
+#include "Rivet/AnalysisHandler.hh"
+#include "Rivet/Tools/RivetPaths.hh"
+#include "HepMC3/GenEvent.h"
+#include "HepMC3/ReaderAscii.h"
+#include "HepMC3/ReaderAsciiHepMC2.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+using namespace Rivet;
+
+/// @brief The bytes received from one FIFO, counting the complete events.
+///
+/// The HepMC readers peek at the first character after an event, so an
+/// event only counts as complete when the line after it has arrived. When
+/// the reader runs out of bytes anyway (the end-of-listing line) the
+/// buffer waits for the FIFO.
+class FifoBuffer : public std::streambuf {
+
+public:
+
+  explicit FifoBuffer(const std::string& path) : _path(path) {
+    _fd = ::open(path.c_str(), O_RDONLY);
+    if(_fd < 0) throw std::runtime_error("rivetFanIn: cannot open " + path + ": " + std::strerror(errno));
+  }
+
+  ~FifoBuffer() {
+    if(_fd >= 0) ::close(_fd);
+  }
+
+  int fd() const { return _fd; }
+
+  const std::string& path() const { return _path; }
+
+  /// True once the writer has closed the FIFO.
+  bool finished() const { return _finished; }
+
+  /// Complete events not yet handed to the reader.
+  size_t ready() const { return _ready; }
+
+  void consumed() { _ready--; }
+
+  /// HepMC version of the stream, 2 or 3, 0 while unknown.
+  int format() const { return _format; }
+
+  /// Read what the FIFO has; false at its end.
+  bool fill() {
+    char chunk[1 << 16];
+    ssize_t n;
+    do n = ::read(_fd, chunk, sizeof(chunk));
+    while(n < 0 && errno == EINTR);
+    if(n < 0) throw std::runtime_error("rivetFanIn: cannot read " + _path + ": " + std::strerror(errno));
+    if(n == 0)
+    {
+        if(!_finished && _inEvent) _ready++;
+        _finished = true;
+        _inEvent = false;
+        return false;
+    }
+
+    // Drop the bytes the reader is done with before the data grows
+    const size_t pos = gptr() - eback();
+    size_t start = _start + pos;
+    if(start > (1 << 20))
+    {
+        _data.erase(0, start);
+        _scanned -= start;
+        start = 0;
+    }
+    _data.append(chunk, n);
+    _start = start;
+    char* base = &_data[0];
+    setg(base + _start, base + _start, base + _data.size());
+    scan();
+    return true;
+  }
+
+protected:
+
+  int_type underflow() {
+    while(gptr() == egptr())
+    {
+        if(_finished || !fill()) return traits_type::eof();
+    }
+    return traits_type::to_int_type(*gptr());
+  }
+
+private:
+
+  /// Count the events completed by the lines received since the last scan.
+  void scan() {
+    for(;;)
+    {
+        const char* p = _data.data() + _scanned;
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', _data.size() - _scanned));
+        if(!nl) break;
+        const size_t len = nl + 1 - p;
+        if(len >= 2 && p[0] == 'E' && p[1] == ' ')
+        {
+            if(_inEvent) _ready++;
+            _inEvent = true;
+        }
+        else if(len >= 7 && std::memcmp(p, "HepMC::", 7) == 0)
+        {
+            if(_inEvent) _ready++;
+            _inEvent = false;
+            const std::string line(p, len);
+            if(_format == 0 && line.find("IO_GenEvent") != std::string::npos) _format = 2;
+            else if(_format == 0 && line.find("Asciiv3") != std::string::npos) _format = 3;
+        }
+        _scanned += len;
+    }
+  }
+
+  std::string _path;
+  int _fd = -1;
+  std::string _data;
+  size_t _start = 0, _scanned = 0, _ready = 0;
+  bool _inEvent = false, _finished = false;
+  int _format = 0;
+
+};
+
+
+/// One generator: its FIFO and the reader on it, made with the first event.
+struct Source {
+  explicit Source(const std::string& path) : buffer(path), in(&buffer) { }
+  FifoBuffer buffer;
+  std::istream in;
+  std::unique_ptr<HepMC3::Reader> reader;
+  long nEvents = 0;
+};
+
+int main(int argc, char** argv) {
+  std::vector<std::string> analyses, preloads, inputs;
+  std::string output = "Rivet.yoda", checkpointFile;
+  bool ignoreBeams = false, pwd = false, resume = false;
+  long maxEvents = -1, every = 10000;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-a" && i + 1 < argc) analyses.push_back(argv[++i]);
+      else if(arg == "-p" && i + 1 < argc) preloads.push_back(argv[++i]);
+      else if(arg == "-o" && i + 1 < argc) output = argv[++i];
+      else if(arg == "-n" && i + 1 < argc) maxEvents = std::atol(argv[++i]);
+      else if(arg == "--checkpoint" && i + 1 < argc) checkpointFile = argv[++i];
+      else if(arg == "--every" && i + 1 < argc) every = std::atol(argv[++i]);
+      else if(arg == "--resume") resume = true;
+      else if(arg == "--ignore-beams") ignoreBeams = true;
+      else if(arg == "--pwd")
+      {
+          pwd = true;
+          char cwd[4096];
+          if(getcwd(cwd, sizeof(cwd)))
+          {
+              addAnalysisLibPath(cwd);
+              addAnalysisDataPath(cwd);
+          }
+      }
+      else inputs.push_back(arg);
+  }
+  if(analyses.empty() || inputs.empty())
+  {
+      std::cerr << "Usage: " << argv[0] << " [--pwd] [--ignore-beams] [-p preload.yoda] [-n events] [-o Rivet.yoda]"
+                << " [--checkpoint Rivet.ckpt.yoda] [--every events] [--resume]"
+                << " -a ANALYSIS[:opt=val...] ... fifo1.hepmc fifo2.hepmc ..." << std::endl;
+      return 1;
+  }
+
+  try
+  {
+      AnalysisHandler ah;
+      ah.setIgnoreBeams(ignoreBeams);
+      for(const std::string& p : preloads) ah.readData(p);
+      ah.addAnalyses(analyses);
+      std::unique_ptr<Checkpoint> checkpoint;
+      if(!checkpointFile.empty()) checkpoint.reset(new Checkpoint(checkpointFile, every, resume));
+
+      // Opening a FIFO waits for its writer, so all generators have started
+      // once the last one is open
+      std::vector<std::unique_ptr<Source> > sources;
+      for(const std::string& in : inputs) sources.emplace_back(new Source(in));
+
+      long nEvents = 0;
+      size_t open = sources.size();
+      while(open > 0 && (maxEvents < 0 || nEvents < maxEvents))
+      {
+          // One event from every source that has a complete one
+          bool any = false;
+          for(std::unique_ptr<Source>& s : sources)
+          {
+              if(s->buffer.ready() == 0 || (maxEvents >= 0 && nEvents >= maxEvents)) continue;
+              if(!s->reader)
+              {
+                  if(s->buffer.format() == 3) s->reader.reset(new HepMC3::ReaderAscii(s->in));
+                  else if(s->buffer.format() == 2) s->reader.reset(new HepMC3::ReaderAsciiHepMC2(s->in));
+                  else throw std::runtime_error("rivetFanIn: " + s->buffer.path() + " is not HepMC2/3 ASCII");
+              }
+              HepMC3::GenEvent ge;
+              s->buffer.consumed();
+              any = true;
+              if(!s->reader->read_event(ge) || s->reader->failed())
+              {
+                  std::cerr << "rivetFanIn: cannot read event " << s->nEvents << " of " << s->buffer.path() << std::endl;
+                  continue;
+              }
+              ah.analyze(ge);
+              if(checkpoint) checkpoint->event(ah);
+              s->nEvents++;
+              nEvents++;
+          }
+          if(any) continue;
+
+          // Wait for more bytes on the open FIFOs
+          std::vector<pollfd> fds;
+          std::vector<Source*> waiting;
+          for(std::unique_ptr<Source>& s : sources)
+          {
+              if(s->buffer.finished()) continue;
+              fds.push_back(pollfd{s->buffer.fd(), POLLIN, 0});
+              waiting.push_back(s.get());
+          }
+          open = fds.size();
+          if(open == 0) break;
+          if(poll(fds.data(), fds.size(), -1) < 0)
+          {
+              if(errno == EINTR) continue;
+              throw std::runtime_error(std::string("rivetFanIn: poll failed: ") + std::strerror(errno));
+          }
+          for(size_t i = 0; i < fds.size(); i++)
+          {
+              if(fds[i].revents & (POLLIN | POLLHUP | POLLERR)) waiting[i]->buffer.fill();
+          }
+      }
+      ah.finalize();
+      ah.writeData(output);
+      if(checkpoint) checkpoint->finish(output, pwd);
+      for(std::unique_ptr<Source>& s : sources)
+        std::cout << s->buffer.path() << ": " << s->nEvents << " events" << std::endl;
+      std::cout << "Analysed " << nEvents << " events, written to " << output << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      return 1;
+  }
+  return 0;
+}
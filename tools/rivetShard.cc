@@ -0,0 +1,194 @@
+// Run Rivet analyses on HepMC files split over several processes, and
+// merge their outputs with rivet-merge.
+//
+// Compile (needs Rivet and HepMC3):
+//   g++ -O2 -std=c++14 -o rivetShard rivetShard.cc $(rivet-config --cppflags --ldflags --libs)
+//
+// Usage:
+//   rivetShard [-j workers] [--pwd] [--ignore-beams] [-p preload.yoda] [-n events] [-o Rivet.yoda]
+//              [--keep-shards] [--index-only] -a ANALYSIS[:opt=val...] [-a ...] file1.hepmc file2.hepmc ...
+// e.g., as in PHENIX_2008_I777211/RunAnalysis.sh,
+//   rivetShard -j 8 --pwd -p ../Centralities/Calibration/calibration_PHENIX_AuAu200GeV.yoda
+//              -a PHENIX_2008_I777211:cent=GEN:beam=AUAU200 -o Rivet.yoda hepmc_AuAu_200GeV_*.hepmc
+//
+// Every input is indexed once (HepMCIndex.hh, saved as FILE.idx), and the
+// events of all inputs, in order, are cut into -j contiguous ranges of
+// the same size. Each worker process reads its range straight from the
+// mapped files, with the header of each file in front so that the reader
+// sees the run information, and writes its own Rivet.shardK.yoda. The
+// shards are then merged as equivalent runs (rivet-merge -e), which
+// re-runs finalize() on the summed raw histograms. Inputs must be
+// uncompressed HepMC2 or HepMC3 ASCII files.
+
+#include "HepMCIndex.hh"
+#include "Rivet/AnalysisHandler.hh"
+#include "Rivet/Tools/RivetPaths.hh"
+#include "HepMC3/GenEvent.h"
+#include "HepMC3/ReaderAscii.h"
+#include "HepMC3/ReaderAsciiHepMC2.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace Rivet;
+
+/// Events [first, last) of input file.
+struct Range {
+  size_t file, first, last;
+};
+
+/// Analyse @a ranges and write the result to @a output.
+static void runShard(std::vector<std::unique_ptr<HepMCIndex> >& indices, const std::vector<Range>& ranges,
+                     const std::vector<std::string>& analyses, const std::vector<std::string>& preloads,
+                     bool ignoreBeams, const std::string& output) {
+  AnalysisHandler ah;
+  ah.setIgnoreBeams(ignoreBeams);
+  for(const std::string& p : preloads) ah.readData(p);
+  ah.addAnalyses(analyses);
+  for(const Range& r : ranges)
+  {
+      HepMCIndex& index = *indices[r.file];
+      std::unique_ptr<SegmentStream> in = index.stream(r.first, r.last);
+      std::unique_ptr<HepMC3::Reader> reader;
+      if(index.format() == 3) reader.reset(new HepMC3::ReaderAscii(*in));
+      else reader.reset(new HepMC3::ReaderAsciiHepMC2(*in));
+      HepMC3::GenEvent ge;
+      while(reader->read_event(ge) && !reader->failed()) ah.analyze(ge);
+  }
+  ah.finalize();
+  ah.writeData(output);
+}
+
+static std::string quote(const std::string& s) {
+  std::string q = "'";
+  for(char c : s) q += (c == '\'') ? std::string("'\\''") : std::string(1, c);
+  return q + "'";
+}
+
+int main(int argc, char** argv) {
+  std::vector<std::string> analyses, preloads, inputs;
+  std::string output = "Rivet.yoda";
+  bool ignoreBeams = false, pwd = false, keepShards = false, indexOnly = false;
+  long maxEvents = -1;
+  int nWorkers = 1;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-a" && i + 1 < argc) analyses.push_back(argv[++i]);
+      else if(arg == "-p" && i + 1 < argc) preloads.push_back(argv[++i]);
+      else if(arg == "-o" && i + 1 < argc) output = argv[++i];
+      else if(arg == "-n" && i + 1 < argc) maxEvents = std::atol(argv[++i]);
+      else if(arg == "-j" && i + 1 < argc) nWorkers = std::max(1, std::atoi(argv[++i]));
+      else if(arg == "--ignore-beams") ignoreBeams = true;
+      else if(arg == "--keep-shards") keepShards = true;
+      else if(arg == "--index-only") indexOnly = true;
+      else if(arg == "--pwd")
+      {
+          pwd = true;
+          char cwd[4096];
+          if(getcwd(cwd, sizeof(cwd)))
+          {
+              addAnalysisLibPath(cwd);
+              addAnalysisDataPath(cwd);
+          }
+      }
+      else inputs.push_back(arg);
+  }
+  if(inputs.empty() || (analyses.empty() && !indexOnly))
+  {
+      std::cerr << "Usage: " << argv[0] << " [-j workers] [--pwd] [--ignore-beams] [-p preload.yoda] [-n events]"
+                << " [-o Rivet.yoda] [--keep-shards] [--index-only] -a ANALYSIS[:opt=val...] ... file.hepmc ..." << std::endl;
+      return 1;
+  }
+
+  try
+  {
+      std::vector<std::unique_ptr<HepMCIndex> > indices;
+      size_t nEvents = 0;
+      for(const std::string& in : inputs)
+      {
+          indices.emplace_back(new HepMCIndex(in));
+          nEvents += indices.back()->size();
+          std::cout << in << ": " << indices.back()->size() << " events" << std::endl;
+      }
+      if(indexOnly) return 0;
+      if(maxEvents >= 0 && size_t(maxEvents) < nEvents) nEvents = maxEvents;
+      nWorkers = std::max<size_t>(1, std::min<size_t>(nWorkers, nEvents));
+
+      // Contiguous slices [k*nEvents/nWorkers, (k+1)*nEvents/nWorkers) of the events of all files
+      std::vector<std::vector<Range> > shards(nWorkers);
+      for(int k = 0; k < nWorkers; k++)
+      {
+          size_t first = k*nEvents/nWorkers, last = (k + 1)*nEvents/nWorkers, offset = 0;
+          for(size_t f = 0; f < indices.size() && first < last; f++)
+          {
+              const size_t n = indices[f]->size();
+              if(first < offset + n)
+              {
+                  const size_t end = std::min(last, offset + n);
+                  shards[k].push_back(Range{f, first - offset, end - offset});
+                  first = end;
+              }
+              offset += n;
+          }
+      }
+
+      const std::string stem = output.size() > 5 && output.compare(output.size() - 5, 5, ".yoda") == 0 ?
+        output.substr(0, output.size() - 5) : output;
+      std::vector<std::string> shardFiles;
+      std::vector<pid_t> workers;
+      for(int k = 0; k < nWorkers; k++)
+      {
+          shardFiles.push_back(nWorkers == 1 ? output : stem + ".shard" + std::to_string(k) + ".yoda");
+          const pid_t pid = fork();
+          if(pid < 0) throw std::runtime_error("rivetShard: cannot start worker " + std::to_string(k));
+          if(pid == 0)
+          {
+              try
+              {
+                  runShard(indices, shards[k], analyses, preloads, ignoreBeams, shardFiles[k]);
+              }
+              catch(const std::exception& e)
+              {
+                  std::cerr << "Worker " << k << ": " << e.what() << std::endl;
+                  _exit(1);
+              }
+              _exit(0);
+          }
+          workers.push_back(pid);
+      }
+      int failed = 0;
+      for(pid_t pid : workers)
+      {
+          int status = 0;
+          if(waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) failed++;
+      }
+      if(failed) throw std::runtime_error("rivetShard: " + std::to_string(failed) + " worker(s) failed");
+      if(nWorkers == 1)
+      {
+          std::cout << "Analysed " << nEvents << " events, written to " << output << std::endl;
+          return 0;
+      }
+
+      std::string merge = "rivet-merge -e";
+      if(pwd) merge += " --pwd";
+      merge += " -o " + quote(output);
+      for(const std::string& f : shardFiles) merge += " " + quote(f);
+      if(std::system(merge.c_str()) != 0) throw std::runtime_error("rivetShard: " + merge + " failed");
+      if(!keepShards)
+      {
+          for(const std::string& f : shardFiles) std::remove(f.c_str());
+      }
+      std::cout << "Analysed " << nEvents << " events in " << nWorkers << " workers, written to " << output << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      return 1;
+  }
+  return 0;
+}
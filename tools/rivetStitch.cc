@@ -0,0 +1,263 @@
+// Run Rivet analyses on a sample generated in pT-hard bins, weighting the
+// events of each bin by its cross section so that one run gives the
+// stitched result.
+//
+// Compile (needs Rivet and HepMC3):
+//   g++ -O2 -std=c++14 -o rivetStitch rivetStitch.cc $(rivet-config --cppflags --ldflags --libs)
+//
+// Usage:
+//   rivetStitch [--pwd] [-p preload.yoda] [-o Rivet.yoda] [-x bins.txt] -a ANALYSIS[:opt=val...] [-a ...]
+//               -b PTMIN:PTMAX file1.hepmc ... [-b PTMIN:PTMAX file.hepmc ...]
+// e.g. for bins written by FIFO/RunFIFO.sh with PTHARDMIN/PTHARDMAX,
+//   rivetStitch --pwd -a ALICE_2013_I1210881 -x bins.txt
+//               -b 5:10 /tmp/fifo5.hepmc -b 10:20 /tmp/fifo10.hepmc -b 20:-1 /tmp/fifo20.hepmc
+//
+// Every event of bin b gets its weights multiplied by sigma_b/N_b, and the
+// cross section of every event is set to the sum of the sigma_b, so that
+// the analyses, which normalise with crossSection()/sumW(), see one sample
+// of the full cross section. sigma_b (pb) and N_b (events generated in the
+// bin, all its files together) are needed before the bin is read: from the
+// side file given with -x, with one line "PTMIN PTMAX SIGMA_PB NEVENTS" per
+// bin, or else from the files of the bin, indexed (HepMCIndex.hh) for the
+// event count. The cross section of a file is that of its last event, the
+// generator's final estimate, and sigma_b their mean weighted with the
+// events of each file. FIFOs, which cannot be read ahead, need the side
+// file. Events without weights get the stitching weight as their only
+// weight; otherwise the generator weights are assumed to be 1, as for Pythia.
+//
+// The bins are read in turn, one event each, so that concurrently running
+// generators progress together. Besides the output, the bins are written
+// to STEM.stitch.yoda as counters /STITCH/PTHARD_MIN_MAX, filled with the
+// stitching weight of each event: their entries are the events read and
+// their sum of weights the cross section the bin contributed.
+
+#include "HepMCIndex.hh"
+#include "Rivet/AnalysisHandler.hh"
+#include "Rivet/Tools/RivetPaths.hh"
+#include "HepMC3/GenCrossSection.h"
+#include "HepMC3/GenEvent.h"
+#include "HepMC3/ReaderAscii.h"
+#include "HepMC3/ReaderAsciiHepMC2.h"
+#include "HepMC3/ReaderFactory.h"
+#include "YODA/Counter.h"
+#include "YODA/IO.h"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Rivet;
+
+/// One pT-hard bin: its files, cross section and event count.
+struct Bin {
+  std::string name;
+  double ptMin = 0., ptMax = -1.;
+  std::vector<std::string> files;
+  double sigma = -1., sigmaErr = 0.;
+  long generated = -1;
+  size_t file = 0;
+  std::shared_ptr<HepMC3::Reader> reader;
+  std::unique_ptr<YODA::Counter> counter;
+
+  /// Read the next event into @a ge, opening the next file as needed;
+  /// false at the end of the bin.
+  bool next(HepMC3::GenEvent& ge) {
+    for(;;)
+    {
+        if(!reader)
+        {
+            if(file == files.size()) return false;
+            struct stat st;
+            // The reader factory looks at the file before reading it, which a FIFO does not allow
+            if(stat(files[file].c_str(), &st) == 0 && S_ISFIFO(st.st_mode))
+              reader = std::make_shared<HepMC3::ReaderAscii>(files[file]);
+            else reader = HepMC3::deduce_reader(files[file]);
+            if(!reader) throw std::runtime_error("rivetStitch: cannot read " + files[file]);
+            file++;
+        }
+        if(reader->read_event(ge) && !reader->failed()) return true;
+        reader->close();
+        reader.reset();
+    }
+  }
+
+  /// Cross section and event count from the files: the index of each file
+  /// gives its events, and its last event the generator's cross section,
+  /// averaged over the files with their event counts as weights.
+  void fromFiles() {
+    generated = 0;
+    long withSigma = 0;
+    double sum = 0., err2 = 0.;
+    for(const std::string& f : files)
+    {
+        HepMCIndex index(f);
+        const long n = index.size();
+        generated += n;
+        if(n == 0) continue;
+        std::unique_ptr<SegmentStream> in = index.stream(n - 1, n);
+        std::unique_ptr<HepMC3::Reader> last;
+        if(index.format() == 3) last.reset(new HepMC3::ReaderAscii(*in));
+        else last.reset(new HepMC3::ReaderAsciiHepMC2(*in));
+        // Only the event matters: the stream ends after it, which a reader
+        // may report as failed
+        HepMC3::GenEvent ge;
+        if(!last->read_event(ge) || !ge.cross_section())
+        {
+            std::cerr << "rivetStitch: no cross section in the last event of " << f << std::endl;
+            continue;
+        }
+        sum += n*ge.cross_section()->xsec();
+        err2 += std::pow(n*ge.cross_section()->xsec_err(), 2);
+        withSigma += n;
+    }
+    if(withSigma == 0) throw std::runtime_error("rivetStitch: no cross section in the files of " + name);
+    sigma = sum/withSigma;
+    sigmaErr = std::sqrt(err2)/withSigma;
+  }
+};
+
+static std::string binName(double ptMin, double ptMax) {
+  std::stringstream ss;
+  ss << "PTHARD_" << ptMin << "_" << ptMax;
+  return ss.str();
+}
+
+int main(int argc, char** argv) {
+  std::vector<std::string> analyses, preloads;
+  std::vector<Bin> bins;
+  std::string output = "Rivet.yoda", sideFile;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-a" && i + 1 < argc) analyses.push_back(argv[++i]);
+      else if(arg == "-p" && i + 1 < argc) preloads.push_back(argv[++i]);
+      else if(arg == "-o" && i + 1 < argc) output = argv[++i];
+      else if(arg == "-x" && i + 1 < argc) sideFile = argv[++i];
+      else if(arg == "-b" && i + 1 < argc)
+      {
+          const std::string range = argv[++i];
+          const size_t colon = range.find(':');
+          if(colon == std::string::npos)
+          {
+              std::cerr << "rivetStitch: bad bin " << range << ", expected PTMIN:PTMAX" << std::endl;
+              return 1;
+          }
+          bins.push_back(Bin());
+          bins.back().ptMin = std::atof(range.substr(0, colon).c_str());
+          bins.back().ptMax = std::atof(range.substr(colon + 1).c_str());
+          bins.back().name = binName(bins.back().ptMin, bins.back().ptMax);
+      }
+      else if(arg == "--pwd")
+      {
+          char cwd[4096];
+          if(getcwd(cwd, sizeof(cwd)))
+          {
+              addAnalysisLibPath(cwd);
+              addAnalysisDataPath(cwd);
+          }
+      }
+      else if(!bins.empty()) bins.back().files.push_back(arg);
+      else
+      {
+          std::cerr << "rivetStitch: " << arg << " does not belong to a bin (-b)" << std::endl;
+          return 1;
+      }
+  }
+  bool noFiles = false;
+  for(const Bin& b : bins) noFiles |= b.files.empty();
+  if(analyses.empty() || bins.empty() || noFiles)
+  {
+      std::cerr << "Usage: " << argv[0] << " [--pwd] [-p preload.yoda] [-o Rivet.yoda] [-x bins.txt]"
+                << " -a ANALYSIS[:opt=val...] ... -b PTMIN:PTMAX file.hepmc ... [-b ...]" << std::endl;
+      return 1;
+  }
+
+  try
+  {
+      // Cross sections and event counts, from the side file or the inputs
+      if(!sideFile.empty())
+      {
+          std::ifstream in(sideFile);
+          if(!in) throw std::runtime_error("rivetStitch: cannot open " + sideFile);
+          std::string line;
+          while(std::getline(in, line))
+          {
+              if(line.empty() || line[0] == '#') continue;
+              std::stringstream ss(line);
+              double ptMin, ptMax, sigma;
+              long n;
+              if(!(ss >> ptMin >> ptMax >> sigma >> n))
+                throw std::runtime_error("rivetStitch: bad line in " + sideFile + ": " + line);
+              for(Bin& b : bins)
+              {
+                  if(b.name != binName(ptMin, ptMax)) continue;
+                  b.sigma = sigma;
+                  b.generated = n;
+              }
+          }
+      }
+      double sigmaTot = 0., sigmaErr2 = 0.;
+      for(Bin& b : bins)
+      {
+          if(b.sigma < 0.) b.fromFiles();
+          if(b.generated <= 0) throw std::runtime_error("rivetStitch: no events generated in " + b.name);
+          sigmaTot += b.sigma;
+          sigmaErr2 += b.sigmaErr*b.sigmaErr;
+          b.counter.reset(new YODA::Counter("/STITCH/" + b.name));
+      }
+
+      AnalysisHandler ah;
+      for(const std::string& p : preloads) ah.readData(p);
+      ah.addAnalyses(analyses);
+
+      std::shared_ptr<HepMC3::GenCrossSection> xs = std::make_shared<HepMC3::GenCrossSection>();
+      long nEvents = 0;
+      for(size_t active = bins.size(); active > 0; )
+      {
+          active = 0;
+          for(Bin& b : bins)
+          {
+              HepMC3::GenEvent ge;
+              if(!b.next(ge)) continue;
+              active++;
+              const double w = b.sigma/b.generated;
+              if(ge.weights().empty()) ge.weights().push_back(w);
+              else for(double& x : ge.weights()) x *= w;
+              ge.set_cross_section(xs);
+              xs->set_cross_section(sigmaTot, std::sqrt(sigmaErr2));
+              ah.analyze(ge);
+              b.counter->fill(w);
+              nEvents++;
+          }
+      }
+      ah.finalize();
+      ah.writeData(output);
+
+      const std::string stem = output.size() > 5 && output.compare(output.size() - 5, 5, ".yoda") == 0 ?
+        output.substr(0, output.size() - 5) : output;
+      std::vector<const YODA::AnalysisObject*> counters;
+      std::cout << "bin  sigma [pb]  generated  read  sigma used [pb]" << std::endl;
+      for(const Bin& b : bins)
+      {
+          counters.push_back(b.counter.get());
+          std::cout << b.name << "  " << b.sigma << "  " << b.generated << "  " << b.counter->numEntries()
+                    << "  " << b.counter->sumW() << std::endl;
+          if(long(b.counter->numEntries()) != b.generated)
+            std::cerr << "rivetStitch: " << b.name << " has " << b.counter->numEntries() << " events, "
+                      << b.generated << " expected: its weight is off by the same ratio" << std::endl;
+      }
+      YODA::write(stem + ".stitch.yoda", counters.begin(), counters.end());
+      std::cout << "Analysed " << nEvents << " events in " << bins.size() << " bins, total cross section "
+                << sigmaTot << " pb, written to " << output << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      return 1;
+  }
+  return 0;
+}
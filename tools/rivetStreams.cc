@@ -0,0 +1,185 @@
+// Run Rivet analyses on several input streams in one process, each stream
+// with its own analysis options (e.g. a pp and an Au+Au sample), and merge
+// them over those options into one output, as rivet-merge -O does.
+//
+// Compile (needs Rivet and HepMC3):
+//   g++ -O2 -std=c++14 -o rivetStreams rivetStreams.cc $(rivet-config --cppflags --ldflags --libs)
+//
+// Usage:
+//   rivetStreams [--pwd] [-p preload.yoda] [-n events] [-o Rivet.yoda] [--keep-streams]
+//                -a ANALYSIS[:opt=val...] [-a ...]
+//                -s OPT=VAL[:OPT=VAL...] file1.hepmc ... [-s OPT=VAL ... file.hepmc ...]
+// e.g. instead of the two runs and merge.sh of PHENIX_2008_I777211,
+//   rivetStreams --pwd -p ../Centralities/Calibration/calibration_PHENIX_AuAu200GeV.yoda
+//                -a PHENIX_2008_I777211:cent=GEN -o Angantyr.yoda
+//                -s beam=AUAU200 hepmc_AuAu_200GeV_*.hepmc -s beam=PP200 hepmc_pp_200GeV_*.hepmc
+//
+// Each stream has its own AnalysisHandler running the analyses with the
+// stream options appended, so the analyses of a stream only see its
+// beams; the plugins are loaded once for the process. The streams are
+// read in turn, one event each, so that they progress together. At the
+// end every stream writes its output to a temporary file and these are
+// merged with rivet-merge -O for each option named in the streams, which
+// runs finalize() once on the combined analysis, e.g. for R_AA.
+
+#include "Rivet/AnalysisHandler.hh"
+#include "Rivet/Tools/RivetPaths.hh"
+#include "HepMC3/GenEvent.h"
+#include "HepMC3/ReaderFactory.h"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <unistd.h>
+
+using namespace Rivet;
+
+/// One input stream: its options, files and analysis handler.
+struct Stream {
+  std::string options;
+  std::vector<std::string> files;
+  size_t file = 0;
+  std::shared_ptr<HepMC3::Reader> reader;
+  std::unique_ptr<AnalysisHandler> handler;
+  long nEvents = 0;
+
+  /// Read the next event into @a ge, opening the next file as needed;
+  /// false at the end of the stream.
+  bool next(HepMC3::GenEvent& ge) {
+    for(;;)
+    {
+        if(!reader)
+        {
+            if(file == files.size()) return false;
+            reader = HepMC3::deduce_reader(files[file]);
+            if(!reader) throw std::runtime_error("rivetStreams: cannot read " + files[file]);
+            file++;
+        }
+        if(reader->read_event(ge) && !reader->failed()) return true;
+        reader->close();
+        reader.reset();
+    }
+  }
+};
+
+static std::string quote(const std::string& s) {
+  std::string q = "'";
+  for(char c : s) q += (c == '\'') ? std::string("'\\''") : std::string(1, c);
+  return q + "'";
+}
+
+int main(int argc, char** argv) {
+  std::vector<std::string> analyses, preloads;
+  std::vector<Stream> streams;
+  std::string output = "Rivet.yoda";
+  bool pwd = false, keepStreams = false;
+  long maxEvents = -1;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-a" && i + 1 < argc) analyses.push_back(argv[++i]);
+      else if(arg == "-p" && i + 1 < argc) preloads.push_back(argv[++i]);
+      else if(arg == "-o" && i + 1 < argc) output = argv[++i];
+      else if(arg == "-n" && i + 1 < argc) maxEvents = std::atol(argv[++i]);
+      else if(arg == "-s" && i + 1 < argc)
+      {
+          streams.push_back(Stream());
+          streams.back().options = argv[++i];
+      }
+      else if(arg == "--keep-streams") keepStreams = true;
+      else if(arg == "--pwd")
+      {
+          pwd = true;
+          char cwd[4096];
+          if(getcwd(cwd, sizeof(cwd)))
+          {
+              addAnalysisLibPath(cwd);
+              addAnalysisDataPath(cwd);
+          }
+      }
+      else if(!streams.empty()) streams.back().files.push_back(arg);
+      else
+      {
+          std::cerr << "rivetStreams: " << arg << " does not belong to a stream (-s)" << std::endl;
+          return 1;
+      }
+  }
+  bool noFiles = false;
+  for(const Stream& s : streams) noFiles |= s.files.empty();
+  if(analyses.empty() || streams.empty() || noFiles)
+  {
+      std::cerr << "Usage: " << argv[0] << " [--pwd] [-p preload.yoda] [-n events] [-o Rivet.yoda] [--keep-streams]"
+                << " -a ANALYSIS[:opt=val...] ... -s OPT=VAL[:OPT=VAL...] file.hepmc ... [-s ...]" << std::endl;
+      return 1;
+  }
+
+  try
+  {
+      // The option names to merge over
+      std::set<std::string> mergeOptions;
+      for(Stream& s : streams)
+      {
+          std::stringstream ss(s.options);
+          std::string item;
+          while(std::getline(ss, item, ':'))
+          {
+              const size_t eq = item.find('=');
+              if(eq == std::string::npos || eq == 0)
+                throw std::runtime_error("rivetStreams: bad stream option " + item + ", expected OPT=VAL");
+              mergeOptions.insert(item.substr(0, eq));
+          }
+
+          s.handler.reset(new AnalysisHandler());
+          for(const std::string& p : preloads) s.handler->readData(p);
+          for(const std::string& a : analyses) s.handler->addAnalysis(a + ":" + s.options);
+      }
+
+      long nEvents = 0;
+      size_t active = streams.size();
+      while(active > 0 && (maxEvents < 0 || nEvents < maxEvents))
+      {
+          active = 0;
+          for(Stream& s : streams)
+          {
+              if(maxEvents >= 0 && nEvents >= maxEvents) break;
+              HepMC3::GenEvent ge;
+              if(!s.next(ge)) continue;
+              s.handler->analyze(ge);
+              s.nEvents++;
+              nEvents++;
+              active++;
+          }
+      }
+
+      const std::string stem = output.size() > 5 && output.compare(output.size() - 5, 5, ".yoda") == 0 ?
+        output.substr(0, output.size() - 5) : output;
+      std::vector<std::string> streamFiles;
+      for(size_t k = 0; k < streams.size(); k++)
+      {
+          streamFiles.push_back(stem + ".stream" + std::to_string(k) + ".yoda");
+          streams[k].handler->finalize();
+          streams[k].handler->writeData(streamFiles.back());
+          std::cout << streams[k].options << ": " << streams[k].nEvents << " events" << std::endl;
+      }
+
+      std::string merge = "rivet-merge";
+      if(pwd) merge += " --pwd";
+      for(const std::string& o : mergeOptions) merge += " -O " + quote(o);
+      merge += " -o " + quote(output);
+      for(const std::string& f : streamFiles) merge += " " + quote(f);
+      if(std::system(merge.c_str()) != 0) throw std::runtime_error("rivetStreams: " + merge + " failed");
+      if(!keepStreams)
+      {
+          for(const std::string& f : streamFiles) std::remove(f.c_str());
+      }
+      std::cout << "Analysed " << nEvents << " events in " << streams.size() << " streams, written to " << output << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,275 @@
+// Merge the YODA outputs of many equivalent Rivet jobs (e.g. one per seed
+// from the RCF/FIFO scripts) in parallel, and run finalize() once on the
+// sum with rivet-merge.
+//
+// Compile (needs YODA):
+//   g++ -O2 -std=c++14 -o yodaTreeMerge yodaTreeMerge.cc $(yoda-config --cppflags --libs)
+//
+// Usage:
+//   yodaTreeMerge [-j workers] [--pwd] [--no-finalize] [-l list.txt] -o merged.yoda job1.yoda job2.yoda ...
+// e.g., for the outputs of RCFFIFOAuAu200.tcsh,
+//   yodaTreeMerge -j 16 --pwd -o Rivet.Au.Au.200GeV.yoda Rivet.Au.Au.200GeV.*Events.seed*.yoda
+//
+// The inputs (given on the command line and/or one per line in -l files)
+// are cut into -j contiguous chunks, each summed by one worker process
+// into a partial file, and the partial files are then summed pairwise in
+// rounds of parallel workers until one is left. A worker holds only its
+// running sum and the file being added, so the memory does not grow with
+// the number of inputs. Counters, histograms and profiles are added bin
+// by bin; the cross section (_XSEC) is averaged with the sum of event
+// weights (_EVTCOUNT) of each side, and other scatters are kept from the
+// first input. Only the raw (/RAW/...) objects of the analyses are
+// meaningful once added: the sum is handed to rivet-merge -e, which runs
+// finalize() on them and so recomputes the final objects, as merging all
+// inputs as equivalent runs would. With --no-finalize the sum is written
+// as it is, to be merged further.
+
+#include "YODA/IO.h"
+#include "YODA/Counter.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Profile2D.h"
+#include "YODA/Scatter1D.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/// @brief Running sum of YODA files, in the order the objects first appear.
+class YodaSum {
+
+public:
+
+  /// Add the objects of @a file.
+  void add(const std::string& file) {
+    std::vector<YODA::AnalysisObject*> raw;
+    YODA::read(file, raw);
+    std::vector<std::unique_ptr<YODA::AnalysisObject> > aos;
+    for(YODA::AnalysisObject* ao : raw) aos.emplace_back(ao);
+
+    // Event weights of both sides, before the counters are added
+    const std::map<std::string, double> wSum = sumW(_aos), wFile = sumW(aos);
+
+    for(std::unique_ptr<YODA::AnalysisObject>& ao : aos)
+    {
+        const std::string path = ao->path();
+        const auto found = _index.find(path);
+        if(found == _index.end())
+        {
+            _index[path] = _aos.size();
+            _aos.push_back(std::move(ao));
+            continue;
+        }
+        YODA::AnalysisObject& sum = *_aos[found->second];
+        try
+        {
+            if(addAs<YODA::Counter>(sum, *ao) || addAs<YODA::Histo1D>(sum, *ao) ||
+               addAs<YODA::Histo2D>(sum, *ao) || addAs<YODA::Profile1D>(sum, *ao) ||
+               addAs<YODA::Profile2D>(sum, *ao)) continue;
+            if(sum.type() != ao->type())
+              throw std::runtime_error("type " + ao->type() + " differs from " + sum.type());
+            if(path.find("_XSEC") != std::string::npos)
+              averageXSec(dynamic_cast<YODA::Scatter1D&>(sum), dynamic_cast<const YODA::Scatter1D&>(*ao),
+                          weight(wSum, path), weight(wFile, path));
+        }
+        catch(const std::exception& e)
+        {
+            throw std::runtime_error("yodaTreeMerge: cannot add " + path + " of " + file + ": " + e.what());
+        }
+    }
+  }
+
+  void write(const std::string& file) const {
+    std::vector<const YODA::AnalysisObject*> aos;
+    for(const std::unique_ptr<YODA::AnalysisObject>& ao : _aos) aos.push_back(ao.get());
+    YODA::write(file, aos.begin(), aos.end());
+  }
+
+private:
+
+  template <typename T>
+  static bool addAs(YODA::AnalysisObject& sum, const YODA::AnalysisObject& ao) {
+    T* s = dynamic_cast<T*>(&sum);
+    const T* a = dynamic_cast<const T*>(&ao);
+    if(!s || !a) return false;
+    *s += *a;
+    return true;
+  }
+
+  /// Sum of event weights of every _EVTCOUNT counter, by the path of the
+  /// matching _XSEC (same RAW prefix and weight name).
+  static std::map<std::string, double> sumW(const std::vector<std::unique_ptr<YODA::AnalysisObject> >& aos) {
+    std::map<std::string, double> w;
+    for(const std::unique_ptr<YODA::AnalysisObject>& ao : aos)
+    {
+        const std::string path = ao->path();
+        const size_t pos = path.find("_EVTCOUNT");
+        const YODA::Counter* c = dynamic_cast<const YODA::Counter*>(ao.get());
+        if(pos == std::string::npos || !c) continue;
+        w[path.substr(0, pos) + "_XSEC" + path.substr(pos + 9)] = c->sumW();
+    }
+    return w;
+  }
+
+  static double weight(const std::map<std::string, double>& w, const std::string& path) {
+    const auto found = w.find(path);
+    return found == w.end() ? 1. : found->second;
+  }
+
+  /// Weighted mean of two cross sections.
+  static void averageXSec(YODA::Scatter1D& sum, const YODA::Scatter1D& xs, double wSum, double wFile) {
+    if(sum.numPoints() != 1 || xs.numPoints() != 1 || wSum + wFile <= 0.) return;
+    YODA::Point1D& a = sum.point(0);
+    const YODA::Point1D& b = xs.point(0);
+    const double ea = 0.5*(a.xErrMinus() + a.xErrPlus()), eb = 0.5*(b.xErrMinus() + b.xErrPlus());
+    const double x = (a.x()*wSum + b.x()*wFile)/(wSum + wFile);
+    const double err = std::sqrt(ea*ea*wSum*wSum + eb*eb*wFile*wFile)/(wSum + wFile);
+    a.setX(x);
+    a.setXErrMinus(err);
+    a.setXErrPlus(err);
+  }
+
+  std::vector<std::unique_ptr<YODA::AnalysisObject> > _aos;
+  std::map<std::string, size_t> _index;
+
+};
+
+/// Sum @a inputs into @a output in a child process.
+static pid_t startWorker(const std::vector<std::string>& inputs, const std::string& output) {
+  const pid_t pid = fork();
+  if(pid < 0) throw std::runtime_error("yodaTreeMerge: cannot start worker for " + output);
+  if(pid > 0) return pid;
+  try
+  {
+      YodaSum sum;
+      for(const std::string& in : inputs) sum.add(in);
+      sum.write(output);
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      _exit(1);
+  }
+  _exit(0);
+}
+
+static void waitWorkers(const std::vector<pid_t>& workers) {
+  int failed = 0;
+  for(pid_t pid : workers)
+  {
+      int status = 0;
+      if(waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) failed++;
+  }
+  if(failed) throw std::runtime_error("yodaTreeMerge: " + std::to_string(failed) + " worker(s) failed");
+}
+
+static std::string quote(const std::string& s) {
+  std::string q = "'";
+  for(char c : s) q += (c == '\'') ? std::string("'\\''") : std::string(1, c);
+  return q + "'";
+}
+
+int main(int argc, char** argv) {
+  std::vector<std::string> inputs;
+  std::string output;
+  bool pwd = false, finalize = true;
+  int nWorkers = 1;
+  for(int i = 1; i < argc; i++)
+  {
+      const std::string arg = argv[i];
+      if(arg == "-o" && i + 1 < argc) output = argv[++i];
+      else if(arg == "-j" && i + 1 < argc) nWorkers = std::max(1, std::atoi(argv[++i]));
+      else if(arg == "--pwd") pwd = true;
+      else if(arg == "--no-finalize") finalize = false;
+      else if(arg == "-l" && i + 1 < argc)
+      {
+          std::ifstream list(argv[++i]);
+          std::string line;
+          while(std::getline(list, line))
+          {
+              if(!line.empty()) inputs.push_back(line);
+          }
+      }
+      else inputs.push_back(arg);
+  }
+  if(output.empty() || inputs.empty())
+  {
+      std::cerr << "Usage: " << argv[0] << " [-j workers] [--pwd] [--no-finalize] [-l list.txt] -o merged.yoda job1.yoda ..." << std::endl;
+      return 1;
+  }
+
+  try
+  {
+      const std::string stem = output.size() > 5 && output.compare(output.size() - 5, 5, ".yoda") == 0 ?
+        output.substr(0, output.size() - 5) : output;
+      auto partName = [&](int round, size_t k) {
+        return stem + ".part" + std::to_string(round) + "." + std::to_string(k) + ".yoda";
+      };
+
+      // Round 0: contiguous chunks of the inputs
+      const size_t nChunks = std::min<size_t>(nWorkers, inputs.size());
+      std::vector<std::string> parts;
+      std::vector<pid_t> workers;
+      for(size_t k = 0; k < nChunks; k++)
+      {
+          const std::vector<std::string> chunk(inputs.begin() + k*inputs.size()/nChunks,
+                                               inputs.begin() + (k + 1)*inputs.size()/nChunks);
+          parts.push_back(partName(0, k));
+          workers.push_back(startWorker(chunk, parts.back()));
+      }
+      waitWorkers(workers);
+
+      // Then pairwise until one part is left
+      for(int round = 1; parts.size() > 1; round++)
+      {
+          std::vector<std::string> next;
+          workers.clear();
+          for(size_t k = 0; k < parts.size(); k += 2)
+          {
+              if(k + 1 == parts.size())
+              {
+                  next.push_back(parts[k]);
+                  continue;
+              }
+              next.push_back(partName(round, k/2));
+              workers.push_back(startWorker({parts[k], parts[k + 1]}, next.back()));
+          }
+          waitWorkers(workers);
+          for(size_t k = 0; k + 1 < parts.size(); k += 2)
+          {
+              std::remove(parts[k].c_str());
+              std::remove(parts[k + 1].c_str());
+          }
+          parts.swap(next);
+      }
+
+      if(!finalize)
+      {
+          if(std::rename(parts.front().c_str(), output.c_str()) != 0)
+            throw std::runtime_error("yodaTreeMerge: cannot write " + output);
+      }
+      else
+      {
+          std::string merge = "rivet-merge -e";
+          if(pwd) merge += " --pwd";
+          merge += " -o " + quote(output) + " " + quote(parts.front());
+          const int status = std::system(merge.c_str());
+          std::remove(parts.front().c_str());
+          if(status != 0) throw std::runtime_error("yodaTreeMerge: " + merge + " failed");
+      }
+      std::cout << "Merged " << inputs.size() << " files into " << output << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+      std::cerr << e.what() << std::endl;
+      return 1;
+  }
+  return 0;
+}